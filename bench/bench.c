@@ -0,0 +1,583 @@
+//============================================================================
+// Ringslice benchmarks on the HOST
+//============================================================================
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ringslice_util.h"
+#include "ringslice.h"
+#include "ringslice_spsc.h"
+
+#define BENCH_BUF_SIZE 4096
+
+static uint8_t bench_buf[BENCH_BUF_SIZE];
+static volatile ringslice_cnt_t bench_sink;  // keeps results alive
+
+/*
+ * Reference implementations.
+ */
+
+/*!
+* Backtracking ringslice_strstr() as it was before Two-Way search,
+* kept as a baseline for comparison
+*/
+static ringslice_t backtracking_strstr(ringslice_t const *const me, char const *substr) {
+    ringslice_t substr_slice = ringslice_initializer(me->buf, me->buf_size, me->first, me->first);
+    uint8_t const *const buf_end = &(me->buf[me->buf_size]);
+    uint8_t const *const buf_start = &(me->buf[0]);
+    uint8_t const *first_ptr = &(me->buf[me->first]);
+    uint8_t const *last_ptr = &(me->buf[me->last]);
+    bool found = false;
+    ringslice_cnt_t cmp_pos = 0;
+    while (first_ptr != last_ptr) {
+        char cmp = substr[cmp_pos];
+        if (cmp == '\0') {
+            found = true;
+            break;
+        }
+        if (*first_ptr == cmp) {
+            cmp_pos++;
+        } else {
+            first_ptr = ringslice_ptr_decrement_wrap_around(first_ptr, cmp_pos, buf_start, buf_end);
+            cmp_pos = 0;
+        }
+        first_ptr = ringslice_ptr_increment_wrap_around(first_ptr, 1, buf_start, buf_end);
+    }
+    if ((first_ptr == last_ptr) && (substr[cmp_pos] == '\0')) {
+        found = true;
+    }
+    if (found) {
+        ringslice_cnt_t idx_last = (ringslice_cnt_t)(first_ptr - buf_start);
+        substr_slice.first = (idx_last >= cmp_pos) ? (idx_last - cmp_pos) : (me->buf_size + idx_last - cmp_pos);
+        substr_slice.last = idx_last;
+    }
+    return substr_slice;
+}
+
+/*
+ * Benchmark helpers.
+ */
+
+/// signature of benchmarked function
+typedef ringslice_cnt_t (*bench_fn_t)(void const *ctx);
+
+/// number of repetitions of each benchmark, the fastest one is reported
+#define BENCH_REPEAT 5
+
+/*!
+* Runs benchmarked function and prints time per call
+* @param[in] name name of benchmark
+* @param[in] fn benchmarked function
+* @param[in] ctx context passed to fn
+* @param[in] iterations number of calls
+*/
+static void bench_run(char const *name, bench_fn_t fn, void const *ctx, long iterations) {
+    double best_ns = 0.0;
+    for (int r = 0; r < BENCH_REPEAT; r++) {
+        struct timespec start, stop;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (long i = 0; i < iterations; i++) {
+            bench_sink = fn(ctx);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        double ns = (double)(stop.tv_sec - start.tv_sec) * 1e9 + (double)(stop.tv_nsec - start.tv_nsec);
+        if (r == 0 || ns < best_ns) {
+            best_ns = ns;
+        }
+    }
+    printf("%-52s %12.1f ns/call\n", name, best_ns / (double)iterations);
+}
+
+/// context of substring search benchmark
+typedef struct {
+    ringslice_t rs;
+    char const *needle;
+} strstr_ctx_t;
+
+static ringslice_cnt_t bench_backtracking_strstr(void const *ctx) {
+    strstr_ctx_t const *c = (strstr_ctx_t const *)ctx;
+    ringslice_t found = backtracking_strstr(&c->rs, c->needle);
+    return found.first;
+}
+
+static ringslice_cnt_t bench_ringslice_strstr(void const *ctx) {
+    strstr_ctx_t const *c = (strstr_ctx_t const *)ctx;
+    ringslice_t found = ringslice_strstr(&c->rs, c->needle);
+    return found.first;
+}
+
+/// context of precompiled pattern search benchmark
+typedef struct {
+    ringslice_t rs;
+    ringslice_pattern_t pattern;
+} pattern_ctx_t;
+
+static ringslice_cnt_t bench_ringslice_find_pattern(void const *ctx) {
+    pattern_ctx_t const *c = (pattern_ctx_t const *)ctx;
+    ringslice_t found = ringslice_find_pattern(&c->rs, &c->pattern);
+    return found.first;
+}
+
+/*!
+* Fills ring buffer with string starting at index first
+* @return ringslice containing the string
+*/
+static ringslice_t bench_fill(char const *str, ringslice_cnt_t len, ringslice_cnt_t first) {
+    for (ringslice_cnt_t i = 0; i < len; i++) {
+        bench_buf[(first + i) % BENCH_BUF_SIZE] = (uint8_t)str[i];
+    }
+    return ringslice_initializer(bench_buf, BENCH_BUF_SIZE, first, (first + len) % BENCH_BUF_SIZE);
+}
+
+/*
+ * Benchmarks.
+ */
+
+static void bench_strstr(void) {
+    static char text[BENCH_BUF_SIZE];
+    static char needle[65];
+    ringslice_cnt_t const len = BENCH_BUF_SIZE - 1;
+    strstr_ctx_t ctx;
+
+    printf("\n--- substring search, %d byte wrapped slice ---\n", (int)len);
+
+    // worst case for backtracking: "AAAA...A" searched for "AAA...AB"
+    memset(text, 'A', (size_t)len);
+    memset(needle, 'A', sizeof(needle) - 2);
+    needle[sizeof(needle) - 2] = 'B';
+    needle[sizeof(needle) - 1] = '\0';
+    ctx.rs = bench_fill(text, len, BENCH_BUF_SIZE / 2);
+    ctx.needle = needle;
+    bench_run("backtracking, \"A...A\" / 63x'A'+'B' (no match)", bench_backtracking_strstr, &ctx, 200);
+    bench_run("ringslice_strstr, \"A...A\" / 63x'A'+'B' (no match)", bench_ringslice_strstr, &ctx, 200);
+
+    // typical case: modem output with terminator at the end
+    for (ringslice_cnt_t i = 0; i < len; i++) {
+        text[i] = "+CREG: 1,5\r\n"[i % 12];
+    }
+    memcpy(&text[len - 6], "OK\r\n\r\n", 6);
+    ctx.rs = bench_fill(text, len, BENCH_BUF_SIZE / 2);
+    ctx.needle = "OK\r\n";
+    bench_run("backtracking, AT response / \"OK\\r\\n\"", bench_backtracking_strstr, &ctx, 2000);
+    bench_run("ringslice_strstr, AT response / \"OK\\r\\n\"", bench_ringslice_strstr, &ctx, 2000);
+
+    // short line searched many times for the same terminator
+    pattern_ctx_t pctx;
+    char const line[] = "+CMGR: \"REC UNREAD\",\"+123\"\r\n";
+    ctx.rs = bench_fill(line, (ringslice_cnt_t)strlen(line), BENCH_BUF_SIZE - 8);
+    ctx.needle = "\r\n";
+    pctx.rs = ctx.rs;
+    pctx.pattern = ringslice_pattern_compile("\r\n");
+    printf("\n--- terminator search, %d byte wrapped line ---\n", (int)strlen(line));
+    bench_run("ringslice_strstr, \"\\r\\n\"", bench_ringslice_strstr, &ctx, 1000000);
+    bench_run("ringslice_find_pattern, precompiled \"\\r\\n\"", bench_ringslice_find_pattern, &pctx, 1000000);
+}
+
+/// context of byte search benchmark
+typedef struct {
+    ringslice_t rs;
+    uint8_t byte;
+} memchr_ctx_t;
+
+static ringslice_cnt_t bench_bytewise_memchr(void const *ctx) {
+    memchr_ctx_t const *c = (memchr_ctx_t const *)ctx;
+    for (ringslice_cnt_t i = 0; i < ringslice_len(&c->rs); i++) {
+        if (ringslice_nth_byte(&c->rs, i) == c->byte) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static ringslice_cnt_t bench_ringslice_memchr(void const *ctx) {
+    memchr_ctx_t const *c = (memchr_ctx_t const *)ctx;
+    return ringslice_memchr(&c->rs, c->byte);
+}
+
+static void bench_memchr(void) {
+    static char text[BENCH_BUF_SIZE];
+    memchr_ctx_t ctx;
+    ringslice_cnt_t const len = BENCH_BUF_SIZE - 1;
+
+    memset(text, 'x', sizeof(text));
+    text[len - 1] = '\n';
+    ctx.rs = bench_fill(text, len, BENCH_BUF_SIZE / 2);
+    ctx.byte = '\n';
+
+    printf("\n--- delimiter search, %d byte wrapped slice ---\n", (int)len);
+    bench_run("ringslice_nth_byte() loop", bench_bytewise_memchr, &ctx, 20000);
+    bench_run("ringslice_memchr", bench_ringslice_memchr, &ctx, 20000);
+}
+
+/*!
+* Byte at relative index as it was computed before division-free wrapping,
+* kept as a baseline for comparison
+*/
+static uint8_t modulo_nth_byte(ringslice_t const *const me, ringslice_cnt_t n) {
+    return me->buf[(me->first + n) % me->buf_size];
+}
+
+static ringslice_cnt_t bench_modulo_sum(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    ringslice_cnt_t sum = 0;
+    ringslice_cnt_t const len = (rs->buf_size + rs->last - rs->first) % rs->buf_size;
+    for (ringslice_cnt_t i = 0; i < len; i++) {
+        sum += modulo_nth_byte(rs, i);
+    }
+    return sum;
+}
+
+static ringslice_cnt_t bench_nth_byte_sum(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    ringslice_cnt_t sum = 0;
+    ringslice_cnt_t const len = ringslice_len(rs);
+    for (ringslice_cnt_t i = 0; i < len; i++) {
+        sum += ringslice_nth_byte(rs, i);
+    }
+    return sum;
+}
+
+static void bench_index(void) {
+    static char text[BENCH_BUF_SIZE];
+    ringslice_cnt_t const len = BENCH_BUF_SIZE - 1;
+    memset(text, 'x', sizeof(text));
+    ringslice_t rs = bench_fill(text, len, BENCH_BUF_SIZE / 2);
+
+    printf("\n--- byte access by index, %d byte wrapped slice ---\n", (int)len);
+    bench_run("modulo wrapping", bench_modulo_sum, &rs, 20000);
+    bench_run(RINGSLICE_CONFIG_POW2 ? "ringslice_nth_byte (mask)" : "ringslice_nth_byte (conditional subtraction)",
+              bench_nth_byte_sum, &rs, 20000);
+}
+
+static ringslice_cnt_t bench_bytewise_memcmp(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    ringslice_cnt_t const len = ringslice_len(rs);
+    for (ringslice_cnt_t i = 0; i < len; i++) {
+        if (ringslice_nth_byte(rs, i) != bench_buf[i]) {
+            return (ringslice_cnt_t)ringslice_nth_byte(rs, i) - (ringslice_cnt_t)bench_buf[i];
+        }
+    }
+    return 0;
+}
+
+static ringslice_cnt_t bench_ringslice_memcmp(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    return ringslice_memcmp(rs, bench_buf, ringslice_len(rs) - 1) != 0;
+}
+
+static void bench_compare(void) {
+    static char text[BENCH_BUF_SIZE];
+    ringslice_cnt_t const len = BENCH_BUF_SIZE - 1;
+    memset(text, 'x', sizeof(text));
+    ringslice_t rs = bench_fill(text, len, BENCH_BUF_SIZE / 2);
+
+    printf("\n--- comparing %d byte wrapped slice with memory ---\n", (int)len);
+    bench_run("ringslice_nth_byte loop", bench_bytewise_memcmp, &rs, 20000);
+    bench_run("ringslice_memcmp", bench_ringslice_memcmp, &rs, 20000);
+}
+
+static ringslice_cnt_t bench_ringslice_scanf(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    int stat = 0, act = 0;
+    unsigned int lac = 0, ci = 0;
+    int argc = ringslice_scanf(rs, "+CREG: %d,%d,\"%x\",\"%x\"", &stat, &act, &lac, &ci);
+    return argc + stat + act + (ringslice_cnt_t)lac + (ringslice_cnt_t)ci;
+}
+
+static ringslice_cnt_t bench_ringslice_scanf_exec(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    static ringslice_scanf_insn_t const creg[] = {
+        RINGSLICE_SCANF_LITERAL("+CREG:"),
+        RINGSLICE_SCANF_SPACES(),
+        RINGSLICE_SCANF_INT(),
+        RINGSLICE_SCANF_LITERAL(","),
+        RINGSLICE_SCANF_INT(),
+        RINGSLICE_SCANF_LITERAL(",\""),
+        RINGSLICE_SCANF_HEX(),
+        RINGSLICE_SCANF_LITERAL("\",\""),
+        RINGSLICE_SCANF_HEX(),
+        RINGSLICE_SCANF_LITERAL("\""),
+        RINGSLICE_SCANF_END(),
+    };
+    int stat = 0, act = 0;
+    unsigned int lac = 0, ci = 0;
+    ringslice_scanf_arg_t const args[] = {
+        RINGSLICE_SCANF_ARG_INT(&stat),
+        RINGSLICE_SCANF_ARG_INT(&act),
+        RINGSLICE_SCANF_ARG_UINT(&lac),
+        RINGSLICE_SCANF_ARG_UINT(&ci),
+    };
+    int argc = ringslice_scanf_exec(rs, creg, args, 4);
+    return argc + stat + act + (ringslice_cnt_t)lac + (ringslice_cnt_t)ci;
+}
+
+static ringslice_cnt_t bench_ringslice_scanf_u64(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    unsigned long long counter = 0, timestamp = 0;
+    int argc = ringslice_scanf(rs, "%llu,%llu", &counter, &timestamp);
+    return argc + (ringslice_cnt_t)counter + (ringslice_cnt_t)timestamp;
+}
+
+static ringslice_cnt_t bench_ringslice_scanf_float(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    double lat = 0, lon = 0;
+    int argc = ringslice_scanf(rs, "$GPGGA,123519,%lf,N,%lf", &lat, &lon);
+    return argc + (ringslice_cnt_t)lat + (ringslice_cnt_t)lon;
+}
+
+static ringslice_cnt_t bench_copy_strtod(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    char line[96];
+    char *end;
+    ringslice_copy_to_cstr(rs, line, sizeof(line));
+    double lat = strtod(&line[sizeof("$GPGGA,123519,") - 1], &end);
+    double lon = strtod(&end[sizeof(",N,") - 1], NULL);
+    return (ringslice_cnt_t)lat + (ringslice_cnt_t)lon;
+}
+
+static void bench_scanf(void) {
+    char const line[] = "+CREG: 2,1,\"1A2B\",\"01C3D4E5\"\r\n";
+    ringslice_t rs = bench_fill(line, (ringslice_cnt_t)strlen(line), BENCH_BUF_SIZE - 12);
+
+    printf("\n--- scanf, %d byte wrapped line ---\n", (int)strlen(line));
+    bench_run("ringslice_scanf, +CREG", bench_ringslice_scanf, &rs, 1000000);
+    bench_run("ringslice_scanf_exec, precompiled +CREG", bench_ringslice_scanf_exec, &rs, 1000000);
+
+    char const counters[] = "18446744073709551615,1700000000123456789\r\n";
+    ringslice_t rs_u64 = bench_fill(counters, (ringslice_cnt_t)strlen(counters), BENCH_BUF_SIZE / 2);
+    bench_run("ringslice_scanf, two 64-bit counters", bench_ringslice_scanf_u64, &rs_u64, 1000000);
+
+    char const gga[] = "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n";
+    ringslice_t rs_gga = bench_fill(gga, (ringslice_cnt_t)strlen(gga), BENCH_BUF_SIZE - 20);
+    bench_run("ringslice_scanf, NMEA lat/lon %lf", bench_ringslice_scanf_float, &rs_gga, 1000000);
+    bench_run("copy out + strtod, NMEA lat/lon", bench_copy_strtod, &rs_gga, 1000000);
+}
+
+/// context of multi-pattern search benchmark
+typedef struct {
+    ringslice_t rs;
+    char const *const *patterns;
+    ringslice_cnt_t pattern_cnt;
+    ringslice_multi_t multi;
+} multi_ctx_t;
+
+static ringslice_cnt_t bench_sequential_strstr(void const *ctx) {
+    multi_ctx_t const *c = (multi_ctx_t const *)ctx;
+    ringslice_cnt_t first = -1;
+    for (ringslice_cnt_t i = 0; i < c->pattern_cnt; i++) {
+        ringslice_t found = ringslice_strstr(&c->rs, c->patterns[i]);
+        if (!ringslice_is_empty(&found)) {
+            first = found.first;
+        }
+    }
+    return first;
+}
+
+static ringslice_cnt_t bench_ringslice_find_multi(void const *ctx) {
+    multi_ctx_t const *c = (multi_ctx_t const *)ctx;
+    ringslice_multi_match_t found = ringslice_find_multi(&c->rs, &c->multi);
+    return found.match.first;
+}
+
+static void bench_multi(void) {
+    static char const *const patterns[] = {
+        "OK\r\n", "ERROR", "+CME ERROR:", "+CMS ERROR:", "RING", "+CMTI:", "+CREG:", "+CGREG:",
+        "+CEREG:", "+CSQ:", "NO CARRIER", "+CMGS:", "+CUSD:", "+CLIP:",
+    };
+    static ringslice_multi_node_t nodes[128];
+    static char text[512];
+    multi_ctx_t ctx;
+
+    for (size_t i = 0; i < sizeof(text); i++) {
+        text[i] = "+CSQX 17,99\r\n"[i % 13];
+    }
+    memcpy(&text[sizeof(text) - 6], "RING\r\n", 6);
+    ctx.rs = bench_fill(text, (ringslice_cnt_t)sizeof(text), BENCH_BUF_SIZE - 100);
+    ctx.patterns = patterns;
+    ctx.pattern_cnt = (ringslice_cnt_t)(sizeof(patterns) / sizeof(patterns[0]));
+    if (!ringslice_multi_build(&ctx.multi, nodes, (ringslice_cnt_t)(sizeof(nodes) / sizeof(nodes[0])), patterns, ctx.pattern_cnt)) {
+        printf("automaton does not fit into nodes storage\n");
+        return;
+    }
+
+    printf("\n--- %d URC patterns, %d byte wrapped slice ---\n", (int)ctx.pattern_cnt, (int)sizeof(text));
+    bench_run("ringslice_strstr for each pattern", bench_sequential_strstr, &ctx, 20000);
+    bench_run("ringslice_find_multi", bench_ringslice_find_multi, &ctx, 20000);
+}
+
+static ringslice_cnt_t bench_lines_one_by_one(void const *ctx) {
+    ringslice_t rs = *(ringslice_t const *)ctx;
+    ringslice_cnt_t sum = 0;
+    for (;;) {
+        ringslice_t line = ringslice_subslice_with_suffix(&rs, 0, "\r\n");
+        if (ringslice_is_empty(&line)) {
+            break;
+        }
+        sum += ringslice_len(&line);
+        rs.first = line.last;
+    }
+    return sum;
+}
+
+static bool bench_line_handler(void *ctx, ringslice_t const *line) {
+    *(ringslice_cnt_t *)ctx += ringslice_nth_byte(line, 0);
+    return true;
+}
+
+static ringslice_cnt_t bench_lines_all(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    ringslice_pattern_t const crlf = ringslice_pattern_compile("\r\n");
+    ringslice_suffix_search_t search = ringslice_suffix_search_initializer(&crlf);
+    ringslice_cnt_t sum = 0;
+    return ringslice_suffix_search_all(&search, rs, bench_line_handler, &sum) + sum;
+}
+
+static void bench_lines(void) {
+    static char text[BENCH_BUF_SIZE];
+    ringslice_cnt_t len = 0;
+    for (int i = 0; i < 50; i++) {
+        len += (ringslice_cnt_t)sprintf(&text[len], "+CSQ: %d,99\r\n", 10 + i);
+    }
+    ringslice_t rs = bench_fill(text, len, BENCH_BUF_SIZE - 300);
+
+    printf("\n--- framing burst of 50 lines, %d byte wrapped slice ---\n", (int)len);
+    bench_run("ringslice_subslice_with_suffix per line", bench_lines_one_by_one, &rs, 20000);
+    bench_run("ringslice_suffix_search_all", bench_lines_all, &rs, 20000);
+}
+
+static ringslice_cnt_t bench_split_strstr(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    ringslice_cnt_t const len = ringslice_len(rs);
+    ringslice_cnt_t sum = 0;
+    ringslice_cnt_t from = 0;
+    while (from < len) {
+        ringslice_t rest = ringslice_subslice(rs, from, len);
+        ringslice_t delim = ringslice_strstr(&rest, ",");
+        ringslice_cnt_t end = ringslice_is_empty(&delim) ? len : from + ringslice_wrap(rs->buf_size + delim.first - rest.first, rs->buf_size);
+        ringslice_t field = ringslice_subslice(rs, from, end);
+        sum += ringslice_len(&field);
+        from = end + 1;
+    }
+    return sum;
+}
+
+static ringslice_cnt_t bench_split_tokenizer(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    ringslice_tokenizer_t tokenizer = ringslice_tokenizer_initializer(rs, ',', 0);
+    ringslice_t field;
+    ringslice_cnt_t sum = 0;
+    while (ringslice_tokenizer_next(&tokenizer, &field)) {
+        sum += ringslice_len(&field);
+    }
+    return sum;
+}
+
+static ringslice_cnt_t bench_split_tokenizer_quoted(void const *ctx) {
+    ringslice_t const *rs = (ringslice_t const *)ctx;
+    ringslice_tokenizer_t tokenizer = ringslice_tokenizer_initializer(rs, ',', '"');
+    ringslice_t field;
+    ringslice_cnt_t sum = 0;
+    while (ringslice_tokenizer_next(&tokenizer, &field)) {
+        sum += ringslice_len(&field);
+    }
+    return sum;
+}
+
+static void bench_tokenizer(void) {
+    static char text[BENCH_BUF_SIZE];
+    ringslice_cnt_t len = 0;
+    while (len + 16 < 512) {
+        len += (ringslice_cnt_t)sprintf(&text[len], "\"field %03d\",", (int)len);
+    }
+    ringslice_t rs = bench_fill(text, len - 1, BENCH_BUF_SIZE - 200);
+
+    printf("\n--- splitting %d byte wrapped CSV line ---\n", (int)(len - 1));
+    bench_run("ringslice_strstr + ringslice_subslice per field", bench_split_strstr, &rs, 100000);
+    bench_run("ringslice_tokenizer_next", bench_split_tokenizer, &rs, 100000);
+    bench_run("ringslice_tokenizer_next, quoted fields", bench_split_tokenizer_quoted, &rs, 100000);
+}
+
+/// number of bytes transferred through SPSC ring by producer thread
+#define BENCH_SPSC_BYTES (4L * 1024L * 1024L)
+
+static ringslice_spsc_t bench_ring;
+
+static void *bench_spsc_producer(void *arg) {
+    ringslice_cnt_t const chunk = *(ringslice_cnt_t const *)arg;
+    uint8_t block[512];
+    for (int i = 0; i < (int)sizeof(block); i++) {
+        block[i] = (uint8_t)i;
+    }
+    long sent = 0;
+    while (sent < BENCH_SPSC_BYTES) {
+        ringslice_cnt_t pushed;
+        if (chunk == 1) {
+            pushed = ringslice_spsc_push(&bench_ring, (uint8_t)sent) ? 1 : 0;
+        } else {
+            pushed = ringslice_spsc_push_bulk(&bench_ring, &block[sent % 256], chunk);
+        }
+        if (pushed == 0) {
+            sched_yield();  // ring is full, let consumer run on single core hosts
+        }
+        sent += pushed;
+    }
+    return NULL;
+}
+
+static ringslice_cnt_t bench_spsc_transfer(void const *ctx) {
+    static uint8_t ring_buf[BENCH_BUF_SIZE];
+    ringslice_cnt_t chunk = *(ringslice_cnt_t const *)ctx;
+    pthread_t producer;
+    long received = 0;
+    ringslice_cnt_t errors = 0;
+
+    ringslice_spsc_init(&bench_ring, ring_buf, BENCH_BUF_SIZE);
+    pthread_create(&producer, NULL, bench_spsc_producer, &chunk);
+    while (received < BENCH_SPSC_BYTES) {
+        ringslice_t rs = ringslice_spsc_acquire_readable(&bench_ring);
+        if (ringslice_is_empty(&rs)) {
+            sched_yield();
+            continue;
+        }
+        ringslice_span_t spans[2];
+        (void)ringslice_spans(&rs, spans);
+        for (int s = 0; s < 2; s++) {
+            for (ringslice_cnt_t i = 0; i < spans[s].len; i++) {
+                errors += (spans[s].ptr[i] != (uint8_t)received++);
+            }
+        }
+        ringslice_spsc_release(&bench_ring, ringslice_len(&rs));
+    }
+    pthread_join(producer, NULL);
+    if (errors != 0) {
+        printf("SPSC ring corrupted %d bytes\n", (int)errors);
+    }
+    return errors;
+}
+
+static void bench_spsc(void) {
+    static ringslice_cnt_t const one = 1;
+    static ringslice_cnt_t const bulk = 64;
+
+    printf("\n--- SPSC ring, producer and consumer threads, %ld bytes per call ---\n", BENCH_SPSC_BYTES);
+    bench_run("ringslice_spsc_push per byte", bench_spsc_transfer, &one, 1);
+    bench_run("ringslice_spsc_push_bulk, 64 byte chunks", bench_spsc_transfer, &bulk, 1);
+}
+
+int main(void) {
+    printf("ringslice benchmarks\n");
+    bench_strstr();
+    bench_memchr();
+    bench_index();
+    bench_compare();
+    bench_scanf();
+    bench_multi();
+    bench_lines();
+    bench_tokenizer();
+    bench_spsc();
+    return 0;
+}
@@ -21,62 +21,602 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include <string.h>
 #include "ringslice_util.h"
 #include "ringslice.h"
 
+#if !RINGSLICE_CONFIG_NO_SIMD && defined(__AVX2__)
+#include <immintrin.h>
+#define RINGSLICE_SIMD_AVX2
+#elif !RINGSLICE_CONFIG_NO_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#define RINGSLICE_SIMD_SSE2
+#elif !RINGSLICE_CONFIG_NO_SIMD && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define RINGSLICE_SIMD_NEON
+#endif
+
 DBC_MODULE_NAME(RINGSLICE_MODULE)
 
-ringslice_t ringslice_strstr(ringslice_t const *const me, char const *substr) {
-    ringslice_t substr_slice = ringslice_initializer(me->buf, me->buf_size, me->first, me->first);  // initialize with empty slice
-    uint8_t const *const buf_end = &(me->buf[me->buf_size]);
-    uint8_t const *const buf_start = &(me->buf[0]);
-    uint8_t const *first_ptr = &(me->buf[me->first]);
-    uint8_t const *last_ptr = &(me->buf[me->last]);
-    bool found = false;
-    ringslice_cnt_t cmp_pos = 0;
-    while (first_ptr != last_ptr) {
-        char cmp = substr[cmp_pos];
-
-        if (cmp == '\0') {
-            found = true;
+/*
+ * Private functions.
+ */
+
+#if defined(RINGSLICE_SIMD_AVX2) || defined(RINGSLICE_SIMD_SSE2) || defined(RINGSLICE_SIMD_NEON)
+/*!
+* Index of the lowest set bit
+* @param[in] mask non-zero value
+*
+* @return index of the lowest set bit
+*
+*/
+static int lowest_set_bit(uint64_t mask) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(mask);
+#else
+    int idx = 0;
+    while ((mask & 1U) == 0U) {
+        mask >>= 1;
+        idx++;
+    }
+    return idx;
+#endif
+}
+#endif
+
+/*!
+* Searches for byte in contiguous memory a machine word at a time
+* @param[in] ptr pointer to the first byte of memory
+* @param[in] len length of memory
+* @param[in] byte searched byte
+*
+* @return pointer to the first occurrence of byte, otherwise NULL
+*
+*/
+static uint8_t const *find_byte_swar(uint8_t const *ptr, ringslice_cnt_t len, uint8_t byte) {
+    uintptr_t const ones = (uintptr_t)-1 / 0xFFU;  // 0x0101...01
+    uintptr_t const highs = ones * 0x80U;          // 0x8080...80
+    uintptr_t const pattern = ones * byte;
+
+    while (len >= (ringslice_cnt_t)sizeof(uintptr_t)) {
+        uintptr_t word;
+        memcpy(&word, ptr, sizeof(word));
+        word ^= pattern;  // bytes equal to searched one become zero
+        if (((word - ones) & ~word & highs) != 0U) {
             break;
         }
+        ptr += sizeof(uintptr_t);
+        len -= (ringslice_cnt_t)sizeof(uintptr_t);
+    }
+    for (; len > 0; len--, ptr++) {
+        if (*ptr == byte) {
+            return ptr;
+        }
+    }
+    return NULL;
+}
 
-        if (*first_ptr == cmp) {
-            cmp_pos++;
+/*!
+* Searches for byte in contiguous memory with the best kernel available for target
+* @param[in] ptr pointer to the first byte of memory
+* @param[in] len length of memory
+* @param[in] byte searched byte
+*
+* @return pointer to the first occurrence of byte, otherwise NULL
+*
+* @note SIMD kernels are selected at compile time by target macros
+*   (__AVX2__, __SSE2__, __ARM_NEON) and may be disabled with RINGSLICE_CONFIG_NO_SIMD.
+*   The remainder shorter than vector and targets without SIMD use word-at-a-time search.
+*
+*/
+static uint8_t const *find_byte(uint8_t const *ptr, ringslice_cnt_t len, uint8_t byte) {
+#if defined(RINGSLICE_SIMD_AVX2)
+    __m256i const needle = _mm256_set1_epi8((char)byte);
+    while (len >= 32) {
+        __m256i const chunk = _mm256_loadu_si256((__m256i const *)(void const *)ptr);
+        uint32_t const mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle));
+        if (mask != 0U) {
+            return &(ptr[lowest_set_bit(mask)]);
+        }
+        ptr += 32;
+        len -= 32;
+    }
+#elif defined(RINGSLICE_SIMD_SSE2)
+    __m128i const needle = _mm_set1_epi8((char)byte);
+    while (len >= 16) {
+        __m128i const chunk = _mm_loadu_si128((__m128i const *)(void const *)ptr);
+        uint32_t const mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle));
+        if (mask != 0U) {
+            return &(ptr[lowest_set_bit(mask)]);
+        }
+        ptr += 16;
+        len -= 16;
+    }
+#elif defined(RINGSLICE_SIMD_NEON)
+    uint8x16_t const needle = vdupq_n_u8(byte);
+    while (len >= 16) {
+        uint8x16_t const eq = vceqq_u8(vld1q_u8(ptr), needle);
+        // narrow each 8-bit lane to 4 bits, so that every byte of chunk is a nibble of mask
+        uint64_t const mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        if (mask != 0U) {
+            return &(ptr[lowest_set_bit(mask) >> 2]);
+        }
+        ptr += 16;
+        len -= 16;
+    }
+#endif
+    return find_byte_swar(ptr, len, byte);
+}
+
+/*!
+* Byte of the view at relative index
+* @param[in] me view instance
+* @param[in] window pointer to contiguous window starting at pos or NULL if window straddles the wrap point
+* @param[in] pos relative index of window
+* @param[in] i index inside of window
+*
+* @return byte at relative index pos + i
+*
+*/
+static uint8_t view_byte(ringslice_view_t const *const me, uint8_t const *window, ringslice_cnt_t pos, ringslice_cnt_t i) {
+    if (window != NULL) {
+        return window[i];
+    }
+    pos += i;
+    return (pos < me->seg_len[0]) ? me->seg[0][pos] : me->seg[1][pos - me->seg_len[0]];
+}
+
+/*!
+* Contiguous window of the view
+* @param[in] me view instance
+* @param[in] pos relative index of window
+* @param[in] len length of window
+*
+* @return pointer to the first byte of window or NULL if window straddles the wrap point
+*
+*/
+static uint8_t const *view_window(ringslice_view_t const *const me, ringslice_cnt_t pos, ringslice_cnt_t len) {
+    if (pos + len <= me->seg_len[0]) {
+        return &(me->seg[0][pos]);
+    }
+    if (pos >= me->seg_len[0]) {
+        return &(me->seg[1][pos - me->seg_len[0]]);
+    }
+    return NULL;
+}
+
+/*!
+* Searches for byte in the view segment by segment
+* @param[in] me view instance
+* @param[in] from relative index to search from (including)
+* @param[in] to relative index to search to (not including)
+* @param[in] byte searched byte
+*
+* @return relative index of the first occurrence of byte, otherwise -1
+*
+*/
+static ringslice_cnt_t view_find_byte(ringslice_view_t const *const me, ringslice_cnt_t from, ringslice_cnt_t to, uint8_t byte) {
+    ringslice_cnt_t base = 0;
+    for (int s = 0; s < 2; s++) {
+        ringslice_cnt_t seg_from = (from > base) ? (from - base) : 0;
+        ringslice_cnt_t seg_to = (to - base < me->seg_len[s]) ? (to - base) : me->seg_len[s];
+        if (seg_from < seg_to) {
+            uint8_t const *found = find_byte(&(me->seg[s][seg_from]), seg_to - seg_from, byte);
+            if (found != NULL) {
+                return base + (ringslice_cnt_t)(found - me->seg[s]);
+            }
+        }
+        base += me->seg_len[s];
+    }
+    return -1;
+}
+
+/*!
+* Computes critical factorization of needle for Two-Way algorithm
+* @param[in] needle needle bytes
+* @param[in] needle_len length of needle, must be greater than 0
+* @param[out] period period of the right half of needle
+*
+* @return index of critical position
+*
+* @note The maximal suffix is computed for both orderings of alphabet
+*   and the longer one is chosen, see Crochemore and Perrin, "Two-way string-matching".
+*
+*/
+static ringslice_cnt_t critical_factorization(uint8_t const *needle, ringslice_cnt_t needle_len, ringslice_cnt_t *period) {
+    ringslice_cnt_t max_suffix = -1;
+    ringslice_cnt_t max_suffix_rev = -1;
+    ringslice_cnt_t j = 0;
+    ringslice_cnt_t k = 1;
+    ringslice_cnt_t p = 1;
+
+    while (j + k < needle_len) {
+        uint8_t a = needle[j + k];
+        uint8_t b = needle[max_suffix + k];
+        if (a < b) {
+            j += k;
+            k = 1;
+            p = j - max_suffix;
+        } else if (a == b) {
+            if (k != p) {
+                k++;
+            } else {
+                j += p;
+                k = 1;
+            }
         } else {
-            first_ptr = ringslice_ptr_decrement_wrap_around(first_ptr, cmp_pos, buf_start, buf_end);
-            cmp_pos = 0;
+            max_suffix = j++;
+            k = p = 1;
         }
+    }
+    *period = p;
 
-        first_ptr = ringslice_ptr_increment_wrap_around(first_ptr, 1, buf_start, buf_end);
+    j = 0;
+    k = p = 1;
+    while (j + k < needle_len) {
+        uint8_t a = needle[j + k];
+        uint8_t b = needle[max_suffix_rev + k];
+        if (b < a) {
+            j += k;
+            k = 1;
+            p = j - max_suffix_rev;
+        } else if (a == b) {
+            if (k != p) {
+                k++;
+            } else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            max_suffix_rev = j++;
+            k = p = 1;
+        }
+    }
+
+    if (max_suffix_rev < max_suffix) {
+        return max_suffix + 1;
     }
+    *period = p;
+    return max_suffix_rev + 1;
+}
 
-    if ((first_ptr == last_ptr) && (substr[cmp_pos] == '\0')) {
-        found = true;
+/*!
+* Estimates how often byte occurs in text protocols
+* @param[in] byte byte to estimate
+*
+* @return rank of byte, the lower rank the rarer byte is expected to be
+*
+*/
+static int byte_rank(uint8_t byte) {
+    if (byte == ' ' || byte == '\r' || byte == '\n' || (byte >= '0' && byte <= '9')) {
+        return 3;
+    }
+    if (byte >= 'a' && byte <= 'z') {
+        return 2;
     }
+    if ((byte >= 'A' && byte <= 'Z') || byte == ',' || byte == '\0') {
+        return 1;
+    }
+    return 0;
+}
+
+/*!
+* Searches for pattern in the view with Two-Way algorithm
+* @param[in] hay view where pattern is searched for
+* @param[in] from relative index to search from
+* @param[in] pattern compiled pattern, must not be empty
+*
+* @return relative index of the first occurrence of pattern at from or after it, otherwise -1
+*
+* @note Search takes linear time and constant memory. Positions where the hint
+*   byte of pattern does not match are skipped with vectorized byte search.
+*
+*/
+static ringslice_cnt_t two_way_search(ringslice_view_t const *const hay, ringslice_cnt_t from, ringslice_pattern_t const *const pattern) {
+    DBC_REQUIRE(300, pattern->len > 0);
+    uint8_t const *const needle = pattern->needle;
+    ringslice_cnt_t const needle_len = pattern->len;
+    ringslice_cnt_t const crit = pattern->crit;
+    ringslice_cnt_t const hint = pattern->hint;
+    ringslice_cnt_t const hay_len = hay->seg_len[0] + hay->seg_len[1];
 
-    if (found) {
-        ringslice_cnt_t suffix_idx_last = (ringslice_cnt_t)(first_ptr - buf_start);
-        ringslice_cnt_t suffix_idx_first = (suffix_idx_last >= cmp_pos) ? (suffix_idx_last - cmp_pos) : (me->buf_size + suffix_idx_last - cmp_pos);
+    ringslice_cnt_t memory = 0;  // length of needle prefix known to match after periodic shift
+    ringslice_cnt_t pos = from;
+    while (pos <= hay_len - needle_len) {
+        if (memory == 0) {
+            ringslice_cnt_t found = view_find_byte(hay, pos + hint, hay_len - needle_len + hint + 1, needle[hint]);
+            if (found < 0) {
+                break;
+            }
+            pos = found - hint;
+        }
+
+        uint8_t const *const window = view_window(hay, pos, needle_len);
+
+        // compare right half
+        ringslice_cnt_t i = (crit > memory) ? crit : memory;
+        while (i < needle_len && needle[i] == view_byte(hay, window, pos, i)) {
+            i++;
+        }
+        if (i < needle_len) {
+            pos += i - crit + 1;
+            memory = 0;
+            continue;
+        }
 
-        DBC_ENSURE(901, 0 <= suffix_idx_first && suffix_idx_first < substr_slice.buf_size);
-        DBC_ENSURE(902, 0 <= suffix_idx_last && suffix_idx_last < substr_slice.buf_size);
-        substr_slice.first = suffix_idx_first;
-        substr_slice.last = suffix_idx_last;
+        // compare left half
+        i = crit - 1;
+        while (i >= memory && needle[i] == view_byte(hay, window, pos, i)) {
+            i--;
+        }
+        if (i < memory) {
+            return pos;
+        }
+        pos += pattern->period;
+        memory = pattern->periodic ? (needle_len - pattern->period) : 0;
     }
+    return -1;
+}
+
+/*!
+* Compares two views lexicographically, segment by segment
+* @param[in] a the first view
+* @param[in] b the second view
+*
+* @return 0 if views are equal, negative value if a appears before b,
+*   positive value if a appears after b; a view that is a prefix of the other one appears before it
+*
+* @note Aligned runs of both views are compared with memcmp(), which makes at most three calls.
+*
+*/
+static int view_compare(ringslice_view_t const *const a, ringslice_view_t const *const b) {
+    int sa = 0;
+    int sb = 0;
+    ringslice_cnt_t ia = 0;
+    ringslice_cnt_t ib = 0;
+
+    for (;;) {
+        while (sa < 2 && ia == a->seg_len[sa]) {
+            sa++;
+            ia = 0;
+        }
+        while (sb < 2 && ib == b->seg_len[sb]) {
+            sb++;
+            ib = 0;
+        }
+        if (sa == 2 || sb == 2) {
+            return (sa == 2) ? ((sb == 2) ? 0 : -1) : 1;
+        }
+
+        ringslice_cnt_t const rest_a = a->seg_len[sa] - ia;
+        ringslice_cnt_t const rest_b = b->seg_len[sb] - ib;
+        ringslice_cnt_t const chunk = (rest_a < rest_b) ? rest_a : rest_b;
+        int const diff = memcmp(&(a->seg[sa][ia]), &(b->seg[sb][ib]), (size_t)chunk);
+        if (diff != 0) {
+            return diff;
+        }
+        ia += chunk;
+        ib += chunk;
+    }
+}
+
+/// lines framed by ringslice_suffix_search_lines()
+typedef struct {
+    ringslice_t *lines;           ///< storage for lines
+    ringslice_cnt_t capacity;     ///< number of elements in storage
+    ringslice_cnt_t cnt;          ///< number of stored lines
+} line_array_t;
+
+/*!
+* Line handler storing lines into array
+* @param[in,out] ctx array of lines, see line_array_t
+* @param[in] line framed line
+*
+* @return false if array is full, otherwise true
+*
+*/
+static bool line_array_push(void *ctx, ringslice_t const *line) {
+    line_array_t *const array = (line_array_t *)ctx;
+    array->lines[array->cnt++] = *line;
+    return array->cnt < array->capacity;
+}
+
+/*
+ * Public functions.
+ */
+
+ringslice_cnt_t ringslice_copy_to_offset(ringslice_t const *const me, ringslice_cnt_t offset, uint8_t *dst, ringslice_cnt_t n) {
+    DBC_REQUIRE(330, 0 <= offset && offset <= ringslice_len(me));
+    DBC_REQUIRE(331, 0 <= n);
+    DBC_REQUIRE(332, dst || n == 0);
+    ringslice_span_t spans[2];
+    ringslice_cnt_t copied = 0;
+    (void)ringslice_spans(me, spans);
+
+    for (int i = 0; i < 2 && copied < n; i++) {
+        if (offset >= spans[i].len) {
+            offset -= spans[i].len;
+            continue;
+        }
+        ringslice_cnt_t chunk = spans[i].len - offset;
+        if (chunk > n - copied) {
+            chunk = n - copied;
+        }
+        memcpy(&(dst[copied]), &(spans[i].ptr[offset]), (size_t)chunk);
+        copied += chunk;
+        offset = 0;
+    }
+
+    return copied;
+}
+
+ringslice_cnt_t ringslice_copy_to(ringslice_t const *const me, uint8_t *dst, ringslice_cnt_t n) {
+    return ringslice_copy_to_offset(me, 0, dst, n);
+}
+
+ringslice_cnt_t ringslice_copy_to_cstr(ringslice_t const *const me, char *dst, ringslice_cnt_t dst_size) {
+    DBC_REQUIRE(333, dst);
+    DBC_REQUIRE(334, dst_size > 0);
+    ringslice_cnt_t copied = ringslice_copy_to_offset(me, 0, (uint8_t *)dst, dst_size - 1);
+    dst[copied] = '\0';
+    return copied;
+}
 
-    return substr_slice;
+ringslice_cnt_t ringslice_memchr(ringslice_t const *const me, uint8_t byte) {
+    ringslice_view_t const view = ringslice_split(me);
+    return view_find_byte(&view, 0, view.seg_len[0] + view.seg_len[1], byte);
+}
+
+ringslice_pattern_t ringslice_pattern_compile(char const *needle) {
+    DBC_REQUIRE(310, needle);
+    return ringslice_pattern_compile_mem((uint8_t const *)needle, (ringslice_cnt_t)strlen(needle));
+}
+
+ringslice_pattern_t ringslice_pattern_compile_mem(uint8_t const *needle, ringslice_cnt_t n) {
+    DBC_REQUIRE(311, needle || n == 0);
+    DBC_REQUIRE(312, 0 <= n);
+    ringslice_pattern_t pattern = {
+        .needle = needle,
+        .len = n,
+        .crit = 0,
+        .period = 1,
+        .hint = 0,
+        .periodic = true,
+    };
+
+    if (pattern.len == 0) {
+        return pattern;
+    }
+
+    pattern.crit = critical_factorization(pattern.needle, pattern.len, &pattern.period);
+    pattern.periodic = (memcmp(pattern.needle, &(pattern.needle[pattern.period]), (size_t)pattern.crit) == 0);
+    if (!pattern.periodic) {
+        pattern.period = ((pattern.crit > pattern.len - pattern.crit) ? pattern.crit : (pattern.len - pattern.crit)) + 1;
+    }
+
+    pattern.hint = pattern.crit;
+    for (ringslice_cnt_t i = 0; i < pattern.len; i++) {
+        if (byte_rank(pattern.needle[i]) < byte_rank(pattern.needle[pattern.hint])) {
+            pattern.hint = i;
+        }
+    }
+
+    return pattern;
+}
+
+ringslice_t ringslice_find_pattern(ringslice_t const *const me, ringslice_pattern_t const *const pattern) {
+    ringslice_t found_slice = ringslice_rel_slice(me, 0, 0);  // initialize with empty slice
+
+    if (pattern->len == 0) {
+        return found_slice;
+    }
+
+    ringslice_view_t const hay = ringslice_split(me);
+    ringslice_cnt_t const pos = two_way_search(&hay, 0, pattern);
+    if (pos >= 0) {
+        found_slice = ringslice_subslice(me, pos, pos + pattern->len);
+        DBC_ENSURE(901, ringslice_len(&found_slice) == pattern->len);
+    }
+
+    return found_slice;
+}
+
+ringslice_t ringslice_subslice_with_pattern(ringslice_t const *const me, ringslice_cnt_t from_idx, ringslice_pattern_t const *const pattern) {
+    ringslice_cnt_t const rs_len = ringslice_len(me);
+    DBC_ASSERT(204, from_idx <= ringslice_len(me));
+
+    ringslice_t resp_slice = ringslice_rel_slice(me, 0, 0);  // initialize with empty slice
+    ringslice_t search_slice = ringslice_subslice(me, from_idx, rs_len);
+    ringslice_t suffix_slice = ringslice_find_pattern(&search_slice, pattern);
+
+    if (ringslice_is_empty(&suffix_slice)) {
+        // resp_slice already initialized with empty slice
+    } else {
+        ringslice_cnt_t const pos = ringslice_wrap(me->buf_size + suffix_slice.first - search_slice.first, me->buf_size);
+        resp_slice = ringslice_rel_slice(me, 0, from_idx + pos + pattern->len);
+    }
+
+    return resp_slice;
+}
+
+ringslice_t ringslice_suffix_search_next(ringslice_suffix_search_t *const me, ringslice_t const *const rs) {
+    ringslice_cnt_t const rs_len = ringslice_len(rs);
+    DBC_REQUIRE(320, 0 <= me->scanned && me->scanned <= rs_len);
+
+    ringslice_t found = ringslice_rel_slice(rs, 0, 0);  // initialize with empty slice
+    ringslice_cnt_t from_idx = me->scanned - me->suffix->len + 1;  // suffix may straddle previous and new bytes
+    if (from_idx < 0) {
+        from_idx = 0;
+    }
+    if (from_idx < rs_len) {
+        found = ringslice_subslice_with_pattern(rs, from_idx, me->suffix);
+    }
+
+    me->scanned = ringslice_is_empty(&found) ? rs_len : 0;
+    return found;
+}
+
+ringslice_cnt_t ringslice_suffix_search_all(ringslice_suffix_search_t *const me, ringslice_t const *const rs,
+                                            ringslice_line_handler_t handler, void *ctx) {
+    ringslice_cnt_t const rs_len = ringslice_len(rs);
+    ringslice_cnt_t const suffix_len = me->suffix->len;
+    DBC_REQUIRE(321, 0 <= me->scanned && me->scanned <= rs_len);
+    DBC_REQUIRE(322, handler);
+
+    ringslice_view_t const hay = ringslice_split(rs);
+    ringslice_cnt_t consumed = 0;
+    ringslice_cnt_t from = me->scanned - suffix_len + 1;  // suffix may straddle previous and new bytes
+    if (from < 0) {
+        from = 0;
+    }
+    me->scanned = rs_len;
+
+    for (;;) {
+        ringslice_cnt_t const pos = two_way_search(&hay, from, me->suffix);
+        if (pos < 0) {
+            break;
+        }
+        ringslice_cnt_t const end = pos + suffix_len;
+        ringslice_t const line = ringslice_rel_slice(rs, consumed, end);
+        consumed = end;
+        from = end;
+        if (!handler(ctx, &line)) {
+            me->scanned = consumed;  // bytes after the last handled line are searched again in the next call
+            break;
+        }
+    }
+
+    me->scanned -= consumed;
+    return consumed;
+}
+
+ringslice_cnt_t ringslice_suffix_search_lines(ringslice_suffix_search_t *const me, ringslice_t const *const rs,
+                                              ringslice_t lines[], ringslice_cnt_t capacity, ringslice_cnt_t *const line_cnt) {
+    DBC_REQUIRE(323, lines);
+    DBC_REQUIRE(324, capacity > 0);
+    DBC_REQUIRE(325, line_cnt);
+    line_array_t array = {
+        .lines = lines,
+        .capacity = capacity,
+        .cnt = 0,
+    };
+    ringslice_cnt_t const consumed = ringslice_suffix_search_all(me, rs, line_array_push, &array);
+    *line_cnt = array.cnt;
+    return consumed;
+}
+
+ringslice_t ringslice_strstr(ringslice_t const *const me, char const *substr) {
+    ringslice_pattern_t const pattern = ringslice_pattern_compile(substr);
+    return ringslice_find_pattern(me, &pattern);
 }
 
 int ringslice_strcmp(ringslice_t const *const me, char const *str) {
     uint8_t const *first_ptr = &(me->buf[me->first]);
-    uint8_t const *last_ptr = &(me->buf[me->last]);
     uint8_t const *const buf_end = &(me->buf[me->buf_size]);
     uint8_t const *const buf_start = &(me->buf[0]);
     uint8_t const *chr = (uint8_t const *)str;
 
-    while (first_ptr != last_ptr) {
+    for (ringslice_cnt_t n = ringslice_len(me); n > 0; n--) {
         int diff = (int)*first_ptr - (int)*chr;
         if (diff) {
             return diff;
@@ -89,19 +629,81 @@ int ringslice_strcmp(ringslice_t const *const me, char const *str) {
     return -(int)*chr;
 }
 
-ringslice_t ringslice_subslice_with_suffix(ringslice_t const *const me, ringslice_cnt_t from_idx, char const *suffix) {
-    ringslice_cnt_t const rs_len = ringslice_len(me);
-    DBC_ASSERT(204, from_idx <= ringslice_len(me));
+int ringslice_memcmp(ringslice_t const *const me, uint8_t const *buf, ringslice_cnt_t n) {
+    DBC_REQUIRE(335, buf || n == 0);
+    DBC_REQUIRE(336, 0 <= n);
+    ringslice_view_t const view = ringslice_split(me);
+    ringslice_view_t const other = {
+        .seg = {buf, buf},
+        .seg_len = {n, 0},
+    };
+    return view_compare(&view, &other);
+}
 
-    ringslice_t resp_slice = ringslice_initializer(me->buf, me->buf_size, me->first, me->first);  // initialize with empty slice
-    ringslice_t search_slice = ringslice_subslice(me, from_idx, rs_len);
-    ringslice_t suffix_slice = ringslice_strstr(&search_slice, suffix);
+bool ringslice_starts_with(ringslice_t const *const me, uint8_t const *buf, ringslice_cnt_t n) {
+    DBC_REQUIRE(337, buf || n == 0);
+    DBC_REQUIRE(338, 0 <= n);
+    if (n > ringslice_len(me)) {
+        return false;
+    }
+    ringslice_t const prefix = ringslice_rel_slice(me, 0, n);
+    return ringslice_memcmp(&prefix, buf, n) == 0;
+}
 
-    if (ringslice_is_empty(&suffix_slice)) {
-        // resp_slice already initialized with empty slice
-    } else {
-        resp_slice.last = suffix_slice.last;
+int ringslice_cmp(ringslice_t const *const a, ringslice_t const *const b) {
+    ringslice_view_t const view_a = ringslice_split(a);
+    ringslice_view_t const view_b = ringslice_split(b);
+    return view_compare(&view_a, &view_b);
+}
+
+bool ringslice_eq(ringslice_t const *const a, ringslice_t const *const b) {
+    if (ringslice_len(a) != ringslice_len(b)) {
+        return false;
     }
+    ringslice_view_t const view_a = ringslice_split(a);
+    ringslice_view_t const view_b = ringslice_split(b);
+    return view_compare(&view_a, &view_b) == 0;
+}
 
-    return resp_slice;
-}
\ No newline at end of file
+ringslice_t ringslice_find_slice(ringslice_t const *const hay, ringslice_t const *const needle) {
+    ringslice_view_t const needle_view = ringslice_split(needle);
+    if (needle_view.seg_len[1] == 0) {
+        ringslice_pattern_t const pattern = ringslice_pattern_compile_mem(needle_view.seg[0], needle_view.seg_len[0]);
+        return ringslice_find_pattern(hay, &pattern);
+    }
+
+    // needle wraps around: search for its longer segment, then compare the other one in place
+    int const s = (needle_view.seg_len[0] >= needle_view.seg_len[1]) ? 0 : 1;
+    ringslice_cnt_t const offset = (s == 0) ? 0 : needle_view.seg_len[0];
+    ringslice_cnt_t const other_offset = (s == 0) ? needle_view.seg_len[0] : 0;
+    ringslice_cnt_t const other_len = needle_view.seg_len[1 - s];
+    ringslice_cnt_t const needle_len = needle_view.seg_len[0] + needle_view.seg_len[1];
+    ringslice_cnt_t const hay_len = ringslice_len(hay);
+    ringslice_pattern_t const pattern = ringslice_pattern_compile_mem(needle_view.seg[s], needle_view.seg_len[s]);
+    ringslice_view_t const hay_view = ringslice_split(hay);
+
+    ringslice_cnt_t from = offset;
+    for (;;) {
+        ringslice_cnt_t const pos = two_way_search(&hay_view, from, &pattern);
+        if (pos < 0 || pos - offset + needle_len > hay_len) {
+            break;
+        }
+        ringslice_cnt_t const start = pos - offset;
+        ringslice_t const other = ringslice_subslice(hay, start + other_offset, start + other_offset + other_len);
+        if (ringslice_memcmp(&other, needle_view.seg[1 - s], other_len) == 0) {
+            return ringslice_subslice(hay, start, start + needle_len);
+        }
+        from = pos + 1;
+    }
+    return ringslice_rel_slice(hay, 0, 0);  // empty slice
+}
+
+ringslice_t ringslice_memmem(ringslice_t const *const me, uint8_t const *needle, ringslice_cnt_t n) {
+    ringslice_pattern_t const pattern = ringslice_pattern_compile_mem(needle, n);
+    return ringslice_find_pattern(me, &pattern);
+}
+
+ringslice_t ringslice_subslice_with_suffix(ringslice_t const *const me, ringslice_cnt_t from_idx, char const *suffix) {
+    ringslice_pattern_t const pattern = ringslice_pattern_compile(suffix);
+    return ringslice_subslice_with_pattern(me, from_idx, &pattern);
+}
@@ -37,9 +37,14 @@ extern "C" {
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "dbc_assert.h"
 #include "ringslice_config.h"
 
+#if RINGSLICE_CONFIG_IOVEC
+#include <sys/uio.h>
+#endif
+
 /// ringslice module name for DBC assertions
 #define RINGSLICE_MODULE                                                "ringslice"
 
@@ -91,6 +96,8 @@ extern "C" {
 static uint8_t ring_buffer[RINGBUFFER_SIZE]; // Example ring buffer
 static volatile int head = 0; // Head index for the ring buffer
 static volatile int tail = 0; // Tail index for the ring buffer
+static ringslice_pattern_t crlf; // Compiled end of line sequence
+static ringslice_suffix_search_t line_search; // State of search for end of line
 
 void uart_isr(void) {
     // Example ISR that fills the ring buffer
@@ -109,11 +116,8 @@ void process_data(void) {
         return; // Nothing to process
     }
     
-    static int processed_bytes = 0; // Counter for processed bytes
-    
-
-    // Search for an end of line sequence "\r\n"
-    ringslice_t found = ringslice_subslice_with_suffix(&rs, processed_bytes, "\r\n");
+    // Search for an end of line sequence "\r\n" among bytes received since previous call
+    ringslice_t found = ringslice_suffix_search_next(&line_search, &rs);
     if (!ringslice_is_empty(&found)) {
         int arg1, arg2;
         int argc = ringslice_scanf(&found, "+CREG: %d, %d", &arg1, &arg2); // Example of parsing data
@@ -121,20 +125,16 @@ void process_data(void) {
             // Process the parsed data
             app_process_registration_status(arg1, arg2);
         }
-        // Reset processed bytes counter
-        processed_bytes = 0;
-        // Update tail index after processing
-        tail = (tail + ringslice_len(&rs)) % RINGBUFFER_SIZE; // Wrap around
-    }
-    else {
-        processed_bytes = ringslice_len(&rs) - 1; // Update processed bytes counter
-                                                  // for optimal next search
+        // Update tail index after processing the line
+        tail = (tail + ringslice_len(&found)) % RINGBUFFER_SIZE; // Wrap around
     }
 }
 
 int main (void) {
     // Initialize UART and other peripherals
     bsp_init();
+    crlf = ringslice_pattern_compile("\r\n");
+    line_search = ringslice_suffix_search_initializer(&crlf);
 
     // Main loop
     while (1) {
@@ -157,6 +157,9 @@ int main (void) {
 /// type for counter
 typedef int32_t ringslice_cnt_t;
 
+/// free-running sequence number of byte in stream, wraps around at 2^32
+typedef uint32_t ringslice_seq_t;
+
 /// ringslice structure
 typedef struct
 {
@@ -164,9 +167,252 @@ typedef struct
     ringslice_cnt_t buf_size;           ///< size of array
     ringslice_cnt_t first;               ///< first (index of the first element that will be processed)
     ringslice_cnt_t last;               ///< last (index of empty place after last element)
+    bool full;                          ///< slice with first == last holds buf_size elements rather than none
+#if RINGSLICE_CONFIG_SEQ
+    ringslice_seq_t seq;                ///< sequence number of the first element, see ringslice_is_valid()
+#endif
 }
 ringslice_t;
 
+/// contiguous span of ring buffer memory
+typedef struct
+{
+    uint8_t *ptr;                       ///< pointer to the first byte of span
+    ringslice_cnt_t len;                ///< number of bytes in span
+}
+ringslice_span_t;
+
+/// precompiled pattern for repeated searches
+typedef struct
+{
+    uint8_t const *needle;              ///< pointer to needle bytes (not copied, must outlive pattern)
+    ringslice_cnt_t len;                ///< length of needle
+    ringslice_cnt_t crit;               ///< critical position of needle (Two-Way factorization)
+    ringslice_cnt_t period;             ///< shift of search window after full match
+    ringslice_cnt_t hint;               ///< index of the rarest needle byte, used for skipping with byte search
+    bool periodic;                      ///< whether needle prefix before crit repeats with period
+}
+ringslice_pattern_t;
+
+/// state of incremental search for suffix in growing ringslice
+typedef struct
+{
+    ringslice_pattern_t const *suffix;  ///< compiled suffix that is searched for
+    ringslice_cnt_t scanned;            ///< number of bytes from beginning of slice that are already searched
+}
+ringslice_suffix_search_t;
+
+/// handler of framed line, returns false to stop framing after this line
+typedef bool (*ringslice_line_handler_t)(void *ctx, ringslice_t const *line);
+
+/// node of multi-pattern search automaton (Aho-Corasick)
+typedef struct
+{
+    uint16_t child;                     ///< index of the first child node, 0 if there are no children
+    uint16_t sibling;                   ///< index of the next sibling node, 0 if there are no more siblings
+    uint16_t fail;                      ///< index of node spelling the longest proper suffix of this node
+    uint16_t dict;                      ///< index of the nearest node on fail chain that ends a pattern, 0 if none
+    uint16_t depth;                     ///< length of string spelled from root to this node
+    int16_t pattern;                    ///< index of pattern ending at this node, -1 if none
+    uint8_t byte;                       ///< byte on edge from parent node to this node
+}
+ringslice_multi_node_t;
+
+/// multi-pattern search automaton
+typedef struct
+{
+    ringslice_multi_node_t const *nodes;    ///< nodes of automaton, nodes[0] is root
+    ringslice_cnt_t node_cnt;               ///< number of nodes
+    ringslice_cnt_t max_len;                ///< length of the longest pattern
+}
+ringslice_multi_t;
+
+/// result of multi-pattern search
+typedef struct
+{
+    ringslice_t match;                  ///< subslice containing matched pattern, empty if nothing is found
+    int pattern;                        ///< index of matched pattern, -1 if nothing is found
+}
+ringslice_multi_match_t;
+
+/// set of bytes, bit (b % 8) of bits[b / 8] is set if byte b belongs to set
+typedef struct
+{
+    uint8_t bits[32];                   ///< membership bitmap
+}
+ringslice_charset_t;
+
+/// state of splitting ringslice into tokens
+typedef struct
+{
+    ringslice_t rest;                   ///< part of slice that is not split yet
+    ringslice_charset_t const *delims;  ///< set of delimiter bytes, NULL if delimiter is a single byte
+    uint8_t delim;                      ///< delimiter byte, used if delims is NULL
+    uint8_t quote;                      ///< quote byte, delimiters between quotes do not split; 0 if quoting is disabled
+    bool done;                          ///< whether the last token is already returned
+}
+ringslice_tokenizer_t;
+
+/// reads remaining count of circular DMA transfer (e.g. NDTR register), 1..buf_size;
+/// DMA in circular mode reloads the count to buf_size instead of leaving 0
+typedef ringslice_cnt_t (*ringslice_dma_remaining_t)(void *ctx);
+
+/// reads transfer complete flag that is set and not cleared by interrupt yet (e.g. TCIF bit)
+typedef bool (*ringslice_dma_pending_t)(void *ctx);
+
+/// ring buffer filled by DMA in circular mode
+typedef struct
+{
+    uint8_t *buf;                       ///< Pointer to zeroth element of ring buffer array
+    ringslice_cnt_t buf_size;           ///< size of array, it is the DMA transfer length
+    ringslice_dma_remaining_t remaining;    ///< reader of remaining count of DMA transfer
+    ringslice_dma_pending_t pending;    ///< reader of pending transfer complete flag, may be NULL
+    void *ctx;                          ///< context passed to remaining and pending
+    volatile ringslice_seq_t laps;      ///< number of completed DMA passes, see ringslice_dma_on_wrap()
+    ringslice_seq_t written;            ///< free-running number of bytes written by DMA as of the last poll
+    ringslice_seq_t tail;               ///< free-running number of released bytes
+    ringslice_cnt_t tail_idx;           ///< index of tail in buffer
+    ringslice_cnt_t head_idx;           ///< index of DMA write position as of the last poll
+    bool overrun;                       ///< whether DMA has overwritten bytes that were not released
+}
+ringslice_dma_t;
+
+#if RINGSLICE_CONFIG_MIRROR
+/// ring buffer memory mapped twice at adjacent addresses (Linux)
+typedef struct
+{
+    uint8_t *buf;                       ///< Pointer to zeroth element of the first mapping, the second one follows it
+    ringslice_cnt_t buf_size;           ///< size of one mapping, multiple of page size
+}
+ringslice_mirror_t;
+#endif
+
+/// length prefix of binary frame
+typedef enum
+{
+    RINGSLICE_PREFIX_U8 = 0,            ///< one byte
+    RINGSLICE_PREFIX_U16_LE,            ///< two bytes, little-endian
+    RINGSLICE_PREFIX_U16_BE,            ///< two bytes, big-endian
+    RINGSLICE_PREFIX_U32_LE,            ///< four bytes, little-endian
+    RINGSLICE_PREFIX_U32_BE,            ///< four bytes, big-endian
+}
+ringslice_prefix_t;
+
+/// byte stuffing of flag-delimited frames (SLIP, HDLC)
+typedef struct
+{
+    uint8_t flag;                       ///< frame delimiter
+    uint8_t esc;                        ///< escape byte
+    uint8_t esc_flag;                   ///< byte following esc that stands for flag
+    uint8_t esc_esc;                    ///< byte following esc that stands for esc
+    uint8_t esc_xor;                    ///< if not 0, any byte following esc stands for itself XOR esc_xor,
+                                        ///< otherwise only esc_flag and esc_esc may follow esc
+}
+ringslice_stuffing_t;
+
+/// operation of precompiled scanf program
+typedef enum
+{
+    RINGSLICE_SCANF_OP_END = 0,         ///< end of program
+    RINGSLICE_SCANF_OP_LITERAL,         ///< match literal bytes
+    RINGSLICE_SCANF_OP_SPACES,          ///< skip any number of whitespaces
+    RINGSLICE_SCANF_OP_INT,             ///< %d, converted to int
+    RINGSLICE_SCANF_OP_UINT,            ///< %u, converted to unsigned int
+    RINGSLICE_SCANF_OP_HEX,             ///< %x or %X, converted to unsigned int
+    RINGSLICE_SCANF_OP_CHARS,           ///< %c, copied to array of char
+    RINGSLICE_SCANF_OP_STRING,          ///< %s, copied to array of char and terminated by null
+    RINGSLICE_SCANF_OP_SCANSET,         ///< %[set] or %[^set], copied to array of char and terminated by null
+    RINGSLICE_SCANF_OP_SLICE,           ///< %r, non-whitespace bytes referenced by subslice
+    RINGSLICE_SCANF_OP_SLICE_SCANSET,   ///< %r[set] or %r[^set], bytes of set referenced by subslice
+    RINGSLICE_SCANF_OP_FLOAT,           ///< %f, %e or %g, converted to float (double with l modifier)
+    RINGSLICE_SCANF_OP_FIXED,           ///< %q<bits>, converted to fixed-point int32_t with len fractional bits
+}
+ringslice_scanf_op_t;
+
+/// length modifier of integer conversion of scanf
+typedef enum
+{
+    RINGSLICE_SCANF_LEN_NONE = 0,       ///< no modifier: int or unsigned int
+    RINGSLICE_SCANF_LEN_HH,             ///< hh: signed char or unsigned char
+    RINGSLICE_SCANF_LEN_H,              ///< h: short or unsigned short
+    RINGSLICE_SCANF_LEN_L,              ///< l: long or unsigned long
+    RINGSLICE_SCANF_LEN_LL,             ///< ll: long long or unsigned long long
+    RINGSLICE_SCANF_LEN_J,              ///< j: intmax_t or uintmax_t
+    RINGSLICE_SCANF_LEN_Z,              ///< z: ptrdiff_t or size_t
+    RINGSLICE_SCANF_LEN_T,              ///< t: ptrdiff_t or size_t
+}
+ringslice_scanf_len_t;
+
+/// instruction of precompiled scanf program
+typedef struct
+{
+    uint8_t op;                         ///< operation, see ringslice_scanf_op_t
+    uint8_t len;                        ///< length modifier of conversion, see ringslice_scanf_len_t,
+                                        ///< or number of fractional bits for RINGSLICE_SCANF_OP_FIXED
+    uint16_t width;                     ///< maximum field width (0 if not limited), or number of literal bytes
+    union
+    {
+        char const *text;               ///< literal bytes for RINGSLICE_SCANF_OP_LITERAL
+        ringslice_charset_t const *set; ///< accepted bytes for RINGSLICE_SCANF_OP_SCANSET
+    } data;                             ///< operand (not copied, must outlive program), NULL for other operations
+}
+ringslice_scanf_insn_t;
+
+/// type of destination of scanf conversion
+typedef enum
+{
+    RINGSLICE_SCANF_TYPE_NONE = 0,      ///< no destination
+    RINGSLICE_SCANF_TYPE_INT,           ///< int
+    RINGSLICE_SCANF_TYPE_UINT,          ///< unsigned int
+    RINGSLICE_SCANF_TYPE_CHAR,          ///< array of char
+    RINGSLICE_SCANF_TYPE_SLICE,         ///< ringslice_t
+    RINGSLICE_SCANF_TYPE_SCHAR,         ///< signed char
+    RINGSLICE_SCANF_TYPE_SHORT,         ///< short
+    RINGSLICE_SCANF_TYPE_LONG,          ///< long
+    RINGSLICE_SCANF_TYPE_LLONG,         ///< long long
+    RINGSLICE_SCANF_TYPE_INTMAX,        ///< intmax_t
+    RINGSLICE_SCANF_TYPE_PTRDIFF,       ///< ptrdiff_t
+    RINGSLICE_SCANF_TYPE_UCHAR,         ///< unsigned char
+    RINGSLICE_SCANF_TYPE_USHORT,        ///< unsigned short
+    RINGSLICE_SCANF_TYPE_ULONG,         ///< unsigned long
+    RINGSLICE_SCANF_TYPE_ULLONG,        ///< unsigned long long
+    RINGSLICE_SCANF_TYPE_UINTMAX,       ///< uintmax_t
+    RINGSLICE_SCANF_TYPE_SIZE,          ///< size_t
+    RINGSLICE_SCANF_TYPE_FLOAT,         ///< float
+    RINGSLICE_SCANF_TYPE_DOUBLE,        ///< double
+    RINGSLICE_SCANF_TYPE_FIXED,         ///< int32_t holding fixed-point value
+}
+ringslice_scanf_type_t;
+
+/// typed destination of scanf conversion
+typedef struct
+{
+    ringslice_scanf_type_t type;        ///< type of destination, must match conversion
+    union
+    {
+        int *i;                         ///< destination for RINGSLICE_SCANF_TYPE_INT
+        unsigned int *u;                ///< destination for RINGSLICE_SCANF_TYPE_UINT
+        char *c;                        ///< destination for RINGSLICE_SCANF_TYPE_CHAR
+        ringslice_t *r;                 ///< destination for RINGSLICE_SCANF_TYPE_SLICE
+        signed char *hh;                ///< destination for RINGSLICE_SCANF_TYPE_SCHAR
+        short *h;                       ///< destination for RINGSLICE_SCANF_TYPE_SHORT
+        long *l;                        ///< destination for RINGSLICE_SCANF_TYPE_LONG
+        long long *ll;                  ///< destination for RINGSLICE_SCANF_TYPE_LLONG
+        intmax_t *j;                    ///< destination for RINGSLICE_SCANF_TYPE_INTMAX
+        ptrdiff_t *t;                   ///< destination for RINGSLICE_SCANF_TYPE_PTRDIFF
+        unsigned char *uhh;             ///< destination for RINGSLICE_SCANF_TYPE_UCHAR
+        unsigned short *uh;             ///< destination for RINGSLICE_SCANF_TYPE_USHORT
+        unsigned long *ul;              ///< destination for RINGSLICE_SCANF_TYPE_ULONG
+        unsigned long long *ull;        ///< destination for RINGSLICE_SCANF_TYPE_ULLONG
+        uintmax_t *uj;                  ///< destination for RINGSLICE_SCANF_TYPE_UINTMAX
+        size_t *z;                      ///< destination for RINGSLICE_SCANF_TYPE_SIZE
+        float *f;                       ///< destination for RINGSLICE_SCANF_TYPE_FLOAT
+        double *lf;                     ///< destination for RINGSLICE_SCANF_TYPE_DOUBLE
+        int32_t *q;                     ///< destination for RINGSLICE_SCANF_TYPE_FIXED
+    } to;                               ///< pointer to destination
+}
+ringslice_scanf_arg_t;
+
 /*!
 * @}
 */
@@ -177,10 +423,30 @@ ringslice_t;
 */
 
 
+/*!
+* Wraps index around buffer without division
+* @param[in] idx index, must be less than twice the buffer size
+* @param[in] buf_size size of buffer
+*
+* @return index between 0 and buf_size - 1
+*
+* @note a single conditional subtraction is used, or bit masking if
+*   RINGSLICE_CONFIG_POW2 is enabled, since software division is
+*   expensive on cores without hardware divider
+*
+*/
+RINGSLICE_INLINE ringslice_cnt_t ringslice_wrap(ringslice_cnt_t idx, ringslice_cnt_t buf_size) {
+#if RINGSLICE_CONFIG_POW2
+    return idx & (buf_size - 1);
+#else
+    return (idx >= buf_size) ? (idx - buf_size) : idx;
+#endif
+}
+
 /*!
 * Initializer for ring slice.
 * @param[in] buf pointer to zeroth element of ring buffer
-* @param[in] buf_size size of buffer
+* @param[in] buf_size size of buffer (power of two if RINGSLICE_CONFIG_POW2 is enabled)
 * @param[in] first index of first element
 * @param[in] last index of empty place after last element
 *
@@ -192,15 +458,111 @@ RINGSLICE_INLINE ringslice_t ringslice_initializer(uint8_t *buf, ringslice_cnt_t
     DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 2, buf_size > 0);
     DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 3, (0 <= first && first < buf_size));
     DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 4, (0 <= last && last < buf_size));
+#if RINGSLICE_CONFIG_POW2
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 8, (buf_size & (buf_size - 1)) == 0);
+#endif
     ringslice_t rs = {
         .buf = buf,
         .buf_size = buf_size,
         .first = first,
         .last = last,
+        .full = false,
+#if RINGSLICE_CONFIG_SEQ
+        .seq = 0,
+#endif
     };
     return rs;
 }
 
+/*!
+* Initializer for ring slice of given length.
+* @param[in] buf pointer to zeroth element of ring buffer
+* @param[in] buf_size size of buffer (power of two if RINGSLICE_CONFIG_POW2 is enabled)
+* @param[in] first index of first element
+* @param[in] len number of elements, up to buf_size
+*
+* @return ring slice instance
+*
+* @note unlike ringslice_initializer(), it can make a slice of the whole buffer
+*
+*/
+RINGSLICE_INLINE ringslice_t ringslice_len_initializer(uint8_t *buf, ringslice_cnt_t buf_size, ringslice_cnt_t first, ringslice_cnt_t len) {
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 18, (0 <= len && len <= buf_size));
+    ringslice_t rs = ringslice_initializer(buf, buf_size, first, ringslice_wrap(first + len, buf_size));
+    rs.full = (len == buf_size);
+    return rs;
+}
+
+#if RINGSLICE_CONFIG_POW2
+/*!
+* Index of ring buffer element holding byte with sequence number
+* @param[in] seq free-running sequence number
+* @param[in] buf_size size of buffer, power of two
+*
+* @return index between 0 and buf_size - 1
+*
+* @note it is bit masking, which is valid since 2^32 is a multiple of buf_size;
+*   with other sizes producers and consumers track the index next to the counter
+*   and advance it with ringslice_wrap() (see ringslice_spsc_t for an example)
+*
+*/
+RINGSLICE_INLINE ringslice_cnt_t ringslice_seq_index(ringslice_seq_t seq, ringslice_cnt_t buf_size) {
+    return (ringslice_cnt_t)(seq & (ringslice_seq_t)(buf_size - 1));
+}
+#endif
+
+/*!
+* Initializer for ring slice from free-running sequence numbers.
+* @param[in] buf pointer to zeroth element of ring buffer
+* @param[in] buf_size size of buffer (power of two if RINGSLICE_CONFIG_POW2 is enabled)
+* @param[in] first index of the byte with sequence number first_seq
+* @param[in] first_seq sequence number of the first byte
+* @param[in] last_seq sequence number after the last byte
+*
+* @return ring slice instance
+*
+* @note length is last_seq - first_seq computed modulo 2^32, so it is correct
+*   when counters wrap around; it may be up to buf_size.
+*   With RINGSLICE_CONFIG_SEQ first_seq is recorded in the slice.
+*
+*/
+RINGSLICE_INLINE ringslice_t ringslice_seq_initializer(uint8_t *buf, ringslice_cnt_t buf_size, ringslice_cnt_t first,
+                                                       ringslice_seq_t first_seq, ringslice_seq_t last_seq) {
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 10, (ringslice_seq_t)(last_seq - first_seq) <= (ringslice_seq_t)buf_size);
+    ringslice_t rs = ringslice_len_initializer(buf, buf_size, first, (ringslice_cnt_t)(last_seq - first_seq));
+#if RINGSLICE_CONFIG_SEQ
+    rs.seq = first_seq;
+#endif
+    return rs;
+}
+
+#if RINGSLICE_CONFIG_SEQ
+/*!
+* Checks that bytes of ringslice are not overwritten by producer yet
+* @param[in] me ringslice taken from ring buffer with sequence number of its first byte
+* @param[in] written number of bytes written by producer so far (free-running),
+*   read after the slice has been parsed
+*
+* @return true if all bytes of slice are still in ring buffer, false if slice is stale
+*
+* @note The byte with sequence number written may be in flight already, so the slice
+*   stays valid while producer is less than buf_size bytes ahead of its first byte.
+*   Later bytes of slice are overwritten later, so the first one is enough to check.
+*   This allows to parse in place and validate afterwards instead of copying:
+*   @code
+*   ringslice_t rs = ringslice_dma_acquire_readable(&dma);
+*   bool ok = (ringslice_scanf(&rs, "$GPGGA,%f,", &time) == 1);
+*   if (!ringslice_dma_is_valid(&dma, &rs)) {
+*       ok = false;  // parsed bytes were overwritten, result is garbage
+*   }
+*   @endcode
+*
+*/
+RINGSLICE_INLINE bool ringslice_is_valid(ringslice_t const * const me, ringslice_seq_t written) {
+    return (ringslice_seq_t)(written - me->seq) < (ringslice_seq_t)me->buf_size;
+}
+#endif
+
 /*!
 * Calculates the length of subslice
 * @param[in] me ringslice instance
@@ -209,7 +571,7 @@ RINGSLICE_INLINE ringslice_t ringslice_initializer(uint8_t *buf, ringslice_cnt_t
 *
 */
 RINGSLICE_INLINE ringslice_cnt_t ringslice_len(ringslice_t const * const me) {
-    return (me->buf_size + me->last - me->first) % me->buf_size;
+    return ringslice_wrap(me->buf_size + me->last - me->first, me->buf_size) + ((ringslice_cnt_t)me->full * me->buf_size);
 }
 
 /*!
@@ -220,7 +582,7 @@ RINGSLICE_INLINE ringslice_cnt_t ringslice_len(ringslice_t const * const me) {
 *
 */
 RINGSLICE_INLINE bool ringslice_is_empty(ringslice_t const * const me) {
-    return (me->first == me->last);
+    return (me->first == me->last) && !me->full;
 }
 
 /*!
@@ -236,7 +598,7 @@ RINGSLICE_INLINE bool ringslice_is_empty(ringslice_t const * const me) {
 RINGSLICE_INLINE uint8_t ringslice_nth_byte(ringslice_t const * const me, ringslice_cnt_t n)
 {
     DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 104, n < ringslice_len(me));
-    ringslice_cnt_t idx = (me->first + n) % me->buf_size;
+    ringslice_cnt_t idx = ringslice_wrap(me->first + n, me->buf_size);
     return me->buf[idx];
 }
 
@@ -257,11 +619,96 @@ RINGSLICE_INLINE ringslice_t ringslice_subslice(ringslice_t const * const me, ri
     ringslice_t rs;
     rs.buf = me->buf;
     rs.buf_size = me->buf_size;
-    rs.first = (me->first + rel_first) % me->buf_size;
-    rs.last = (me->first + rel_last) % me->buf_size;
+    rs.first = ringslice_wrap(me->first + rel_first, me->buf_size);
+    rs.last = ringslice_wrap(me->first + rel_last, me->buf_size);
+    rs.full = (rel_last - rel_first == me->buf_size);
+#if RINGSLICE_CONFIG_SEQ
+    rs.seq = me->seq + (ringslice_seq_t)rel_first;
+#endif
     return rs;
 }
 
+/*!
+* Contiguous spans of ring buffer memory occupied by ringslice
+* @param[in] me ringslice instance
+* @param[out] spans two spans; bytes of slice are bytes of spans[0] followed by bytes of spans[1].
+*   Both spans are always filled, unused ones have zero length.
+*
+* @return number of non-empty spans: 0 for empty slice, 2 if slice wraps around, otherwise 1
+*
+* @note spans may be passed directly to write(), CRC or DMA engines without copying
+*
+*/
+RINGSLICE_INLINE int ringslice_spans(ringslice_t const * const me, ringslice_span_t spans[2]) {
+    spans[0].ptr = &(me->buf[me->first]);
+    spans[1].ptr = &(me->buf[0]);
+    if (me->first <= me->last && !me->full) {
+        spans[0].len = me->last - me->first;
+        spans[1].len = 0;
+        return (spans[0].len != 0) ? 1 : 0;
+    }
+    spans[0].len = me->buf_size - me->first;
+    spans[1].len = me->last;
+    return (spans[1].len != 0) ? 2 : 1;
+}
+
+#if RINGSLICE_CONFIG_IOVEC
+/*!
+* Contiguous spans of ring buffer memory occupied by ringslice as I/O vectors
+* @param[in] me ringslice instance
+* @param[out] iov two I/O vectors, see ringslice_spans()
+*
+* @return number of non-empty I/O vectors, which may be passed as iovcnt to writev()
+*
+*/
+RINGSLICE_INLINE int ringslice_iovec(ringslice_t const * const me, struct iovec iov[2]) {
+    ringslice_span_t spans[2];
+    int const cnt = ringslice_spans(me, spans);
+    for (int i = 0; i < 2; i++) {
+        iov[i].iov_base = spans[i].ptr;
+        iov[i].iov_len = (size_t)spans[i].len;
+    }
+    return cnt;
+}
+#endif
+
+/*!
+* Copies bytes of ringslice starting at relative offset into memory
+* @param[in] me ringslice instance
+* @param[in] offset relative index of the first copied byte
+* @param[out] dst destination memory
+* @param[in] n maximal number of bytes to copy
+*
+* @return number of copied bytes, which is less than n if slice is shorter
+*
+* @note at most two memcpy() calls are made
+*
+*/
+ringslice_cnt_t ringslice_copy_to_offset(ringslice_t const * const me, ringslice_cnt_t offset, uint8_t * dst, ringslice_cnt_t n);
+
+/*!
+* Copies bytes of ringslice into memory
+* @param[in] me ringslice instance
+* @param[out] dst destination memory
+* @param[in] n maximal number of bytes to copy
+*
+* @return number of copied bytes, which is less than n if slice is shorter
+*
+*/
+ringslice_cnt_t ringslice_copy_to(ringslice_t const * const me, uint8_t * dst, ringslice_cnt_t n);
+
+/*!
+* Copies ringslice into string buffer
+* @param[in] me ringslice instance
+* @param[out] dst destination string buffer, always null-terminated
+* @param[in] dst_size size of destination buffer including terminating null character
+*
+* @return number of copied characters excluding terminating null character;
+*   slice is truncated if it does not fit into buffer
+*
+*/
+ringslice_cnt_t ringslice_copy_to_cstr(ringslice_t const * const me, char * dst, ringslice_cnt_t dst_size);
+
 /*!
 * Compares ringslice instance with string lexicographically
 * @param[in] me ringslice instance which is compared with string
@@ -274,6 +721,68 @@ RINGSLICE_INLINE ringslice_t ringslice_subslice(ringslice_t const * const me, ri
 */
 int ringslice_strcmp(ringslice_t const * const me, char const * str);
 
+/*!
+* Compares whole ringslice with n bytes of memory lexicographically, like ringslice_strcmp()
+* @param[in] me ringslice instance which is compared with memory
+* @param[in] buf memory for compare, may contain any bytes including 0
+* @param[in] n number of bytes in buf
+*
+* @return 0 if are equal, i.e. slice has exactly n bytes equal to buf,
+*   negative value if ringslice appears before buf in lexicographical order,
+*   positive value if ringslice appears after buf in lexicographical order;
+*   slice that is a prefix of buf appears before it and vice versa
+*
+* @note Unlike memcmp(), lengths matter: a slice longer than n is never equal to buf.
+*   Use ringslice_starts_with() to check the first n bytes only.
+*   Each contiguous segment of slice is compared with memcmp().
+*
+*/
+int ringslice_memcmp(ringslice_t const * const me, uint8_t const * buf, ringslice_cnt_t n);
+
+/*!
+* Checks whether ringslice begins with n bytes of memory
+* @param[in] me ringslice instance
+* @param[in] buf memory for compare, may contain any bytes including 0
+* @param[in] n number of bytes in buf
+*
+* @return true if slice has at least n bytes and the first n of them equal buf, otherwise false
+*
+* @note it is ringslice_memcmp() of ringslice_subslice(me, 0, n), e.g. to check a sync word:
+*   @code
+*   static uint8_t const sync[] = {0xAA, 0x55};
+*   if (ringslice_starts_with(&rs, sync, sizeof(sync))) {
+*       // frame starts at rs.first
+*   }
+*   @endcode
+*
+*/
+bool ringslice_starts_with(ringslice_t const * const me, uint8_t const * buf, ringslice_cnt_t n);
+
+/*!
+* Compares two ringslices lexicographically
+* @param[in] a the first ringslice, it may belong to another ring buffer than b
+* @param[in] b the second ringslice
+*
+* @return 0 if are equal, negative value if a appears before b in lexicographical order,
+*   positive value if a appears after b; slice that is a prefix of the other one appears before it
+*
+* @note both slices may wrap around; runs where both are contiguous are compared with memcmp()
+*
+*/
+int ringslice_cmp(ringslice_t const * const a, ringslice_t const * const b);
+
+/*!
+* Checks whether two ringslices contain the same bytes
+* @param[in] a the first ringslice, it may belong to another ring buffer than b
+* @param[in] b the second ringslice
+*
+* @return true if slices have equal length and bytes, otherwise false
+*
+* @note lengths are compared first, so slices of different length are not scanned
+*
+*/
+bool ringslice_eq(ringslice_t const * const a, ringslice_t const * const b);
+
 /*!
 * Searches for substring in ringslice instance
 * @param[in] me ringslice instance where substring is searched for
@@ -282,10 +791,96 @@ int ringslice_strcmp(ringslice_t const * const me, char const * str);
 * @return subslice of me slice containing substring, otherwise empty ringslice
 *
 * @note if substr is empty string, then copy of me slice will be returned
+* @note search uses Two-Way algorithm, so it takes linear time and
+*   constant memory regardless of contents of slice and substring
 *
 */
 ringslice_t ringslice_strstr(ringslice_t const * const me, char const * substr);
 
+/*!
+* Searches for binary needle in ringslice instance
+* @param[in] me ringslice instance where needle is searched for
+* @param[in] needle searched bytes, may contain any bytes including 0
+* @param[in] n number of bytes in needle
+*
+* @return subslice of me slice containing needle, otherwise empty ringslice
+*
+* @note the same Two-Way search as in ringslice_strstr() is used
+*
+*/
+ringslice_t ringslice_memmem(ringslice_t const * const me, uint8_t const * needle, ringslice_cnt_t n);
+
+/*!
+* Searches for bytes of one ringslice in another one
+* @param[in] hay ringslice instance where needle is searched for
+* @param[in] needle ringslice with searched bytes, it may belong to another ring buffer and wrap around
+*
+* @return subslice of hay containing bytes of needle, otherwise empty ringslice
+*
+* @note needle is never copied. If it is contiguous, it is searched as in ringslice_memmem().
+*   Otherwise its longer segment is searched and the shorter one is compared with memcmp()
+*   at each candidate position.
+*
+*/
+ringslice_t ringslice_find_slice(ringslice_t const * const hay, ringslice_t const * const needle);
+
+/*!
+* Searches for byte in ringslice instance
+* @param[in] me ringslice instance where byte is searched for
+* @param[in] byte searched byte
+*
+* @return relative index of the first occurrence of byte, -1 if there is no such byte
+*
+* @note each contiguous segment of slice is searched with SIMD kernel if target supports it
+*   (see RINGSLICE_CONFIG_NO_SIMD), otherwise a machine word at a time
+*
+*/
+ringslice_cnt_t ringslice_memchr(ringslice_t const * const me, uint8_t byte);
+
+/*!
+* Compiles pattern for repeated searches
+* @param[in] needle searched string; it is referenced by pattern, not copied
+*
+* @return compiled pattern
+*
+* @note compilation takes time proportional to length of needle,
+*   so compile frequently searched needles once and reuse the pattern
+*
+*/
+ringslice_pattern_t ringslice_pattern_compile(char const * needle);
+
+/*!
+* Compiles binary pattern for repeated searches
+* @param[in] needle searched bytes, may contain any bytes including 0;
+*   they are referenced by pattern, not copied
+* @param[in] n number of bytes in needle
+*
+* @return compiled pattern
+*
+*/
+ringslice_pattern_t ringslice_pattern_compile_mem(uint8_t const * needle, ringslice_cnt_t n);
+
+/*!
+* Searches for compiled pattern in ringslice instance
+* @param[in] me ringslice instance where pattern is searched for
+* @param[in] pattern compiled pattern
+*
+* @return subslice of me slice containing pattern, otherwise empty ringslice
+*
+*/
+ringslice_t ringslice_find_pattern(ringslice_t const * const me, ringslice_pattern_t const * const pattern);
+
+/*!
+* Searches for subslice ending with compiled pattern in ringslice instance
+* @param[in] me ringslice instance where pattern is searched for
+* @param[in] from_idx start index for searching; if 0, then search from beginning of the slice
+* @param[in] pattern compiled pattern that is searched for
+*
+* @return subslice of me slice from its beginning up to the end of pattern, otherwise empty ringslice
+*
+*/
+ringslice_t ringslice_subslice_with_pattern(ringslice_t const * const me, ringslice_cnt_t from_idx, ringslice_pattern_t const * const pattern);
+
 /*!
 * Searches for subslice with suffix in ringslice instance
 * @param[in] me ringslice instance where suffix is searched for
@@ -299,6 +894,419 @@ ringslice_t ringslice_strstr(ringslice_t const * const me, char const * substr);
 */
 ringslice_t ringslice_subslice_with_suffix(ringslice_t const * const me, ringslice_cnt_t from_idx, char const * suffix);
 
+/*!
+* @}
+*/
+
+/**
+* @defgroup RingsliceIncrementalSearch Ringslice Incremental Search
+* @{
+*/
+
+/*!
+* Initializer for incremental suffix search.
+* @param[in] suffix compiled suffix; it is referenced by search state, not copied
+*
+* @return search state instance
+*
+*/
+RINGSLICE_INLINE ringslice_suffix_search_t ringslice_suffix_search_initializer(ringslice_pattern_t const * const suffix) {
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 5, suffix);
+    ringslice_suffix_search_t search = {
+        .suffix = suffix,
+        .scanned = 0,
+    };
+    return search;
+}
+
+/*!
+* Continues search for suffix in ringslice that has grown since previous call
+* @param[in,out] me search state instance
+* @param[in] rs ringslice with the same first index as in previous call and
+*   possibly more bytes at its end
+*
+* @return subslice of rs from its beginning up to the end of suffix, otherwise empty ringslice
+*
+* @note Only bytes appended since previous call are searched (plus length of suffix - 1
+*   bytes before them), so suffix split between calls is found as well.
+*   After suffix is found the search state is reset, and the next call expects a slice
+*   that starts after returned subslice, i.e. the caller consumes the returned bytes.
+*
+*/
+ringslice_t ringslice_suffix_search_next(ringslice_suffix_search_t * const me, ringslice_t const * const rs);
+
+/*!
+* Frames all complete lines of ringslice that has grown since previous call
+* @param[in,out] me search state instance, its suffix terminates lines
+* @param[in] rs ringslice with the same first index as in previous call and
+*   possibly more bytes at its end
+* @param[in] handler function called for each line (including suffix) in order;
+*   if it returns false, framing stops after that line
+* @param[in] ctx context passed to handler
+*
+* @return number of bytes from beginning of rs consumed by handled lines
+*
+* @note The whole slice is searched in one pass, so a burst of lines costs
+*   a single call. The caller advances its tail by the returned number of bytes
+*   once, and the next call expects a slice that starts there. Incomplete line
+*   at the end is remembered as searched, as in ringslice_suffix_search_next().
+*
+*/
+ringslice_cnt_t ringslice_suffix_search_all(ringslice_suffix_search_t * const me, ringslice_t const * const rs,
+                                            ringslice_line_handler_t handler, void *ctx);
+
+/*!
+* Frames complete lines of ringslice into array
+* @param[in,out] me search state instance, its suffix terminates lines
+* @param[in] rs ringslice, see ringslice_suffix_search_all()
+* @param[out] lines storage for lines (including suffix)
+* @param[in] capacity number of elements in lines storage; framing stops when it is full
+* @param[out] line_cnt number of stored lines
+*
+* @return number of bytes from beginning of rs consumed by stored lines
+*
+*/
+ringslice_cnt_t ringslice_suffix_search_lines(ringslice_suffix_search_t * const me, ringslice_t const * const rs,
+                                              ringslice_t lines[], ringslice_cnt_t capacity, ringslice_cnt_t * const line_cnt);
+
+/*!
+* @}
+*/
+
+/**
+* @defgroup RingsliceMultiSearch Ringslice Multi-pattern Search
+* @{
+*/
+
+/*!
+* Initializer for multi-pattern search automaton.
+* @param[in] nodes nodes of automaton built with ringslice_multi_build(),
+*   e.g. constant table placed in flash
+* @param[in] node_cnt number of nodes
+* @param[in] max_len length of the longest pattern
+*
+* @return automaton instance
+*
+*/
+RINGSLICE_INLINE ringslice_multi_t ringslice_multi_initializer(ringslice_multi_node_t const *nodes, ringslice_cnt_t node_cnt, ringslice_cnt_t max_len) {
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 6, nodes);
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 7, node_cnt > 0);
+    ringslice_multi_t multi = {
+        .nodes = nodes,
+        .node_cnt = node_cnt,
+        .max_len = max_len,
+    };
+    return multi;
+}
+
+/*!
+* Builds multi-pattern search automaton
+* @param[out] me automaton instance
+* @param[out] nodes storage for nodes of automaton
+* @param[in] capacity number of elements in nodes storage; total length of patterns + 1 is always enough
+* @param[in] patterns array of searched strings
+* @param[in] pattern_cnt number of patterns
+*
+* @return true if automaton is built, false if nodes storage is too small
+*
+* @note Nodes refer to each other by indexes only, so the built array may be
+*   generated once on host and then declared as a constant table in flash,
+*   see ringslice_multi_dump().
+*
+*/
+bool ringslice_multi_build(ringslice_multi_t * const me, ringslice_multi_node_t nodes[], ringslice_cnt_t capacity,
+                           char const * const patterns[], ringslice_cnt_t pattern_cnt);
+
+/*!
+* Searches for all patterns of automaton in ringslice instance in a single pass
+* @param[in] me ringslice instance where patterns are searched for
+* @param[in] multi automaton instance
+*
+* @return the leftmost match (the longest one if several patterns start at the same index)
+*   and index of matched pattern; empty subslice and -1 if nothing is found
+*
+*/
+ringslice_multi_match_t ringslice_find_multi(ringslice_t const * const me, ringslice_multi_t const * const multi);
+
+/*!
+* Prints automaton as C source of constant tables
+* @param[in] me automaton instance built with ringslice_multi_build()
+* @param[in] name name of emitted ringslice_multi_t variable, nodes are emitted as name_nodes
+* @param[out] dst destination buffer for NUL-terminated text, may be NULL if dst_size is 0
+* @param[in] dst_size size of destination buffer
+*
+* @return length of the whole text (like snprintf()), text is truncated if it is not less than dst_size
+*
+* @note Host-side helper in ringslice_dump.c (requires snprintf()): build automaton
+*   on host, dump it into a header and search with the emitted constant in flash
+*   without linking ringslice_multi_build() on target.
+*
+*/
+ringslice_cnt_t ringslice_multi_dump(ringslice_multi_t const * const me, char const * name, char * dst, ringslice_cnt_t dst_size);
+
+/*!
+* @}
+*/
+
+/**
+* @defgroup RingsliceTokenizer Ringslice Tokenizer
+* @{
+*/
+
+/*!
+* Initializer for tokenizer splitting ringslice by delimiter byte.
+* @param[in] rs ringslice that is split; tokens are subslices of it
+* @param[in] delim delimiter byte
+* @param[in] quote quote byte, delimiters between a pair of quotes do not split; 0 disables quoting
+*
+* @return tokenizer instance
+*
+*/
+RINGSLICE_INLINE ringslice_tokenizer_t ringslice_tokenizer_initializer(ringslice_t const * const rs, uint8_t delim, uint8_t quote) {
+    ringslice_tokenizer_t tokenizer = {
+        .rest = *rs,
+        .delims = NULL,
+        .delim = delim,
+        .quote = quote,
+        .done = false,
+    };
+    return tokenizer;
+}
+
+/*!
+* Initializer for tokenizer splitting ringslice by any byte of delimiter set.
+* @param[in] rs ringslice that is split; tokens are subslices of it
+* @param[in] delims set of delimiter bytes, e.g. compiled with ringslice_charset_compile();
+*   it is referenced by tokenizer, not copied
+* @param[in] quote quote byte, delimiters between a pair of quotes do not split; 0 disables quoting
+*
+* @return tokenizer instance
+*
+*/
+RINGSLICE_INLINE ringslice_tokenizer_t ringslice_tokenizer_set_initializer(ringslice_t const * const rs, ringslice_charset_t const * const delims, uint8_t quote) {
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 9, delims);
+    ringslice_tokenizer_t tokenizer = ringslice_tokenizer_initializer(rs, 0, quote);
+    tokenizer.delims = delims;
+    return tokenizer;
+}
+
+/*!
+* Takes the next token
+* @param[in,out] me tokenizer instance
+* @param[out] token subslice between the previous delimiter (or beginning of slice)
+*   and the next delimiter (or end of slice); surrounding quotes are excluded
+*   if token starts and ends with quote byte
+*
+* @return true if token is taken, false if all tokens are already taken
+*
+* @note Tokens are not copied. Empty fields produce empty tokens, so "a,,b" gives
+*   three tokens and an empty slice gives one empty token, as strsep() does.
+*   Scanning resumes after the previous delimiter, so splitting into all tokens
+*   takes a single pass over slice; a single delimiter byte without quoting is
+*   searched with ringslice_memchr().
+*
+*/
+bool ringslice_tokenizer_next(ringslice_tokenizer_t * const me, ringslice_t * const token);
+
+/*!
+* @}
+*/
+
+/**
+* @defgroup RingsliceFraming Ringslice Binary Framing
+* @{
+*/
+
+/// SLIP byte stuffing (RFC 1055)
+#define RINGSLICE_STUFFING_SLIP         { .flag = 0xC0, .esc = 0xDB, .esc_flag = 0xDC, .esc_esc = 0xDD, .esc_xor = 0 }
+/// HDLC-like byte stuffing (RFC 1662), escaped bytes are XORed with 0x20
+#define RINGSLICE_STUFFING_HDLC         { .flag = 0x7E, .esc = 0x7D, .esc_flag = 0x5E, .esc_esc = 0x5D, .esc_xor = 0x20 }
+
+/*!
+* Locates length-prefixed frame at the beginning of ringslice
+* @param[in] me ringslice instance
+* @param[in] prefix size and byte order of length prefix; the length counts payload bytes only
+* @param[in] max_len maximal length of payload accepted
+* @param[out] payload subslice of me with payload of frame, set only if frame is complete
+*
+* @return number of bytes of the whole frame (prefix and payload) if it is complete,
+*   0 if more bytes are needed, -1 if length exceeds max_len (stream should be resynchronized)
+*
+*/
+ringslice_cnt_t ringslice_frame_prefixed(ringslice_t const * const me, ringslice_prefix_t prefix, ringslice_cnt_t max_len,
+                                         ringslice_t * const payload);
+
+/*!
+* Locates frame terminated by delimiter byte at the beginning of ringslice
+* @param[in] me ringslice instance
+* @param[in] delim delimiter byte, e.g. 0 for COBS or flag of ringslice_stuffing_t
+* @param[out] frame subslice of me up to delimiter (not including), set only if delimiter is found
+*
+* @return number of bytes of frame including delimiter, 0 if there is no delimiter yet
+*
+* @note Frame is not decoded; it may be empty if delimiters follow each other,
+*   which is how SLIP and HDLC senders flush line noise.
+*
+*/
+ringslice_cnt_t ringslice_frame_delimited(ringslice_t const * const me, uint8_t delim, ringslice_t * const frame);
+
+/*!
+* Decodes COBS encoded frame
+* @param[in] frame encoded frame without the zero delimiter, see ringslice_frame_delimited()
+* @param[out] dst destination memory
+* @param[in] dst_size size of destination memory; length of frame is always enough
+*
+* @return length of decoded data, -1 if frame is malformed or dst is too small
+*
+* @note Runs between code bytes are copied with ringslice_copy_to_offset().
+*
+*/
+ringslice_cnt_t ringslice_cobs_decode(ringslice_t const * const frame, uint8_t * dst, ringslice_cnt_t dst_size);
+
+/*!
+* Removes byte stuffing of SLIP or HDLC frame
+* @param[in] frame stuffed frame without flags, see ringslice_frame_delimited()
+* @param[in] stuffing stuffing rules, e.g. RINGSLICE_STUFFING_SLIP or RINGSLICE_STUFFING_HDLC
+* @param[out] dst destination memory
+* @param[in] dst_size size of destination memory; length of frame is always enough
+*
+* @return length of unstuffed data, -1 if escape sequence is invalid or dst is too small
+*
+* @note If ringslice_memchr() finds no esc byte in frame, the frame may be
+*   used in place and unstuffing may be skipped. HDLC FCS is not checked.
+*
+*/
+ringslice_cnt_t ringslice_unstuff(ringslice_t const * const frame, ringslice_stuffing_t const * const stuffing,
+                                  uint8_t * dst, ringslice_cnt_t dst_size);
+
+/*!
+* @}
+*/
+
+/**
+* @defgroup RingsliceDma Ringslice DMA Producer
+* @{
+*/
+
+/*!
+* Initializes ring buffer filled by DMA in circular mode
+* @param[out] me ring buffer instance
+* @param[in] buf pointer to zeroth element of ring buffer, DMA destination
+* @param[in] buf_size size of buffer, DMA transfer length
+* @param[in] remaining reader of remaining count of DMA transfer
+* @param[in] pending reader of transfer complete flag not cleared by interrupt yet, or NULL
+* @param[in] ctx context passed to remaining and pending
+*
+* @note must be called when DMA is started, i.e. its write position is 0.
+*   With pending, a wrap whose interrupt is late by up to a whole lap is counted.
+*   Without it, the interrupt must be serviced before DMA passes the position
+*   of the previous poll, otherwise a lap and thus an overrun may be missed.
+*
+*/
+void ringslice_dma_init(ringslice_dma_t * const me, uint8_t *buf, ringslice_cnt_t buf_size,
+                        ringslice_dma_remaining_t remaining, ringslice_dma_pending_t pending, void *ctx);
+
+/*!
+* Counts completed DMA pass, must be called from DMA transfer complete interrupt
+* @param[in,out] me ring buffer instance
+*
+* @note this is the only interrupt needed, one per buf_size bytes; it lets
+*   consumer detect overruns of a whole lap between its polls
+*
+*/
+RINGSLICE_INLINE void ringslice_dma_on_wrap(ringslice_dma_t * const me) {
+    me->laps = me->laps + 1;
+}
+
+/*!
+* Takes snapshot of bytes written by DMA and not released yet
+* @param[in,out] me ring buffer instance
+*
+* @return ringslice with received bytes, empty ringslice if overrun is detected
+*
+* @note Write position is derived from the remaining count. A wrap whose
+*   transfer complete interrupt is still pending is accounted as well,
+*   see ringslice_dma_init() for how late the interrupt may be.
+*   If DMA has written buf_size bytes or more after the tail, the next write may
+*   already be replacing the oldest unread byte, so the same rule as in ringslice_is_valid()
+*   applies: me->overrun is set and stays set until ringslice_dma_resync().
+*   Thus at most buf_size - 1 bytes are returned.
+*
+*/
+ringslice_t ringslice_dma_acquire_readable(ringslice_dma_t * const me);
+
+/*!
+* Releases bytes at the beginning of readable ringslice
+* @param[in,out] me ring buffer instance
+* @param[in] n number of released bytes, must not exceed length of the last snapshot
+*
+*/
+void ringslice_dma_release(ringslice_dma_t * const me, ringslice_cnt_t n);
+
+/*!
+* Drops all unread bytes and clears overrun
+* @param[in,out] me ring buffer instance
+*
+* @note the next snapshot starts at the DMA write position of the last poll
+*
+*/
+void ringslice_dma_resync(ringslice_dma_t * const me);
+
+#if RINGSLICE_CONFIG_SEQ
+/*!
+* Checks that ringslice taken from DMA ring buffer is not overwritten yet
+* @param[in,out] me ring buffer instance, DMA write position is polled
+* @param[in] rs ringslice returned by ringslice_dma_acquire_readable() or its subslice
+*
+* @return true if bytes of rs are still intact, false if DMA has overwritten them
+*
+* @note call it after parsing rs in place; see ringslice_is_valid()
+*
+*/
+bool ringslice_dma_is_valid(ringslice_dma_t * const me, ringslice_t const * const rs);
+#endif
+
+/*!
+* @}
+*/
+
+#if RINGSLICE_CONFIG_MIRROR
+/**
+* @defgroup RingsliceMirror Ringslice Mirrored Buffer
+* @{
+*/
+
+/*!
+* Allocates ring buffer mapped twice at adjacent addresses
+* @param[out] me ring buffer instance
+* @param[in] buf_size size of buffer, multiple of page size
+*
+* @return true on success, false if memory could not be mapped (errno is set)
+*
+* @note buf[i] and buf[buf_size + i] are the same byte. Slices of buf are ordinary
+*   ring slices, but ringslice_len() bytes of any of them may also be read in one piece
+*   at &buf[first], e.g. by write() or by code that needs contiguous memory.
+*
+*/
+bool ringslice_mirror_init(ringslice_mirror_t * const me, ringslice_cnt_t buf_size);
+
+/*!
+* Unmaps ring buffer
+* @param[in,out] me ring buffer instance
+*
+*/
+void ringslice_mirror_deinit(ringslice_mirror_t * const me);
+
+/*!
+* @}
+*/
+#endif
+
+/**
+* @defgroup RingsliceScanf Ringslice Scanf
+* @{
+*/
+
 /*!
 * scanf implementation for ringslice
 * @param[in] rs ringslice instance
@@ -308,9 +1316,180 @@ ringslice_t ringslice_subslice_with_suffix(ringslice_t const * const me, ringsli
 * @return a number of receiving arguments succesfully assigned
     or first on error.
 *
+* @note Besides %d, %u, %x, %c, %s and %[set] there are zero-copy conversions
+*   %r and %r[set] that take ringslice_t * and set it to subslice of rs
+*   referencing the matched bytes in place, e.g. "+CMGR: \"%r[^\"]\"".
+*   Integer conversions accept length modifiers hh, h, l, ll, j, z and t
+*   (%zd and %td take ptrdiff_t *, %zu and %tu take size_t *).
+*   A value that does not fit its destination fails the conversion.
+*   Width limits numeric conversions too, counting from the first char
+*   after whitespaces, e.g. "%2d%d" reads "1234" as 12 and 34.
+*   %f, %e and %g (float *, or double * with l) parse [+-]digits[.digits][e[+-]digits]
+*   and round correctly for any number of digits; they are
+*   available if RINGSLICE_CONFIG_SCANF_FLOAT is set.
+*   %q<bits>, e.g. %q16, parses the same syntax to fixed-point int32_t with
+*   the given number of fractional bits, rounding to nearest; it uses integer
+*   arithmetic only.
+*
 */
 int ringslice_scanf(ringslice_t const * const rs, const char *fmt, ...);
 
+/// instruction matching literal string, str must be a string literal
+#define RINGSLICE_SCANF_LITERAL(str)    { .op = RINGSLICE_SCANF_OP_LITERAL, .width = sizeof(str) - 1, .data = { .text = (str) } }
+/// instruction skipping whitespaces, same as a whitespace in format string
+#define RINGSLICE_SCANF_SPACES()        { .op = RINGSLICE_SCANF_OP_SPACES, .width = 0, .data = { .text = NULL } }
+/// instruction of %d conversion
+#define RINGSLICE_SCANF_INT()           { .op = RINGSLICE_SCANF_OP_INT, .width = 0, .data = { .text = NULL } }
+/// instruction of %u conversion
+#define RINGSLICE_SCANF_UINT()          { .op = RINGSLICE_SCANF_OP_UINT, .width = 0, .data = { .text = NULL } }
+/// instruction of %x conversion
+#define RINGSLICE_SCANF_HEX()           { .op = RINGSLICE_SCANF_OP_HEX, .width = 0, .data = { .text = NULL } }
+/// instruction of %d conversion with length modifier lm (ringslice_scanf_len_t)
+#define RINGSLICE_SCANF_INT_LEN(lm)     { .op = RINGSLICE_SCANF_OP_INT, .len = (lm), .width = 0, .data = { .text = NULL } }
+/// instruction of %u conversion with length modifier lm (ringslice_scanf_len_t)
+#define RINGSLICE_SCANF_UINT_LEN(lm)    { .op = RINGSLICE_SCANF_OP_UINT, .len = (lm), .width = 0, .data = { .text = NULL } }
+/// instruction of %x conversion with length modifier lm (ringslice_scanf_len_t)
+#define RINGSLICE_SCANF_HEX_LEN(lm)     { .op = RINGSLICE_SCANF_OP_HEX, .len = (lm), .width = 0, .data = { .text = NULL } }
+/// instruction of %f conversion
+#define RINGSLICE_SCANF_FLOAT()         { .op = RINGSLICE_SCANF_OP_FLOAT, .len = RINGSLICE_SCANF_LEN_NONE, .width = 0, .data = { .text = NULL } }
+/// instruction of %lf conversion
+#define RINGSLICE_SCANF_DOUBLE()        { .op = RINGSLICE_SCANF_OP_FLOAT, .len = RINGSLICE_SCANF_LEN_L, .width = 0, .data = { .text = NULL } }
+/// instruction of %q<bits> conversion, bits is number of fractional bits (0..31)
+#define RINGSLICE_SCANF_FIXED(bits)     { .op = RINGSLICE_SCANF_OP_FIXED, .len = (bits), .width = 0, .data = { .text = NULL } }
+/// instruction of %<width>c conversion
+#define RINGSLICE_SCANF_CHARS(w)        { .op = RINGSLICE_SCANF_OP_CHARS, .width = (w), .data = { .text = NULL } }
+/// instruction of %<width>s conversion, 0 means unlimited width
+#define RINGSLICE_SCANF_STRING(w)       { .op = RINGSLICE_SCANF_OP_STRING, .width = (w), .data = { .text = NULL } }
+/// instruction of %<width>[set] conversion, cs is pointer to ringslice_charset_t, 0 means unlimited width
+#define RINGSLICE_SCANF_SCANSET(w, cs)  { .op = RINGSLICE_SCANF_OP_SCANSET, .width = (w), .data = { .set = (cs) } }
+/// instruction of %<width>r conversion, 0 means unlimited width
+#define RINGSLICE_SCANF_SLICE(w)        { .op = RINGSLICE_SCANF_OP_SLICE, .width = (w), .data = { .set = NULL } }
+/// instruction of %<width>r[set] conversion, cs is pointer to ringslice_charset_t, 0 means unlimited width
+#define RINGSLICE_SCANF_SLICE_SCANSET(w, cs) { .op = RINGSLICE_SCANF_OP_SLICE_SCANSET, .width = (w), .data = { .set = (cs) } }
+/// instruction of conversion o (ringslice_scanf_op_t) with length modifier lm and width w, e.g. %2hhd
+#define RINGSLICE_SCANF_CONV(o, lm, w)  { .op = (o), .len = (lm), .width = (w), .data = { .text = NULL } }
+/// instruction terminating program
+#define RINGSLICE_SCANF_END()           { .op = RINGSLICE_SCANF_OP_END, .width = 0, .data = { .text = NULL } }
+
+/// destination for RINGSLICE_SCANF_INT(), ptr must be int *
+#define RINGSLICE_SCANF_ARG_INT(ptr)    { .type = RINGSLICE_SCANF_TYPE_INT, .to = { .i = (ptr) } }
+/// destination for RINGSLICE_SCANF_UINT() and RINGSLICE_SCANF_HEX(), ptr must be unsigned int *
+#define RINGSLICE_SCANF_ARG_UINT(ptr)   { .type = RINGSLICE_SCANF_TYPE_UINT, .to = { .u = (ptr) } }
+/// destination for RINGSLICE_SCANF_CHARS(), RINGSLICE_SCANF_STRING() and RINGSLICE_SCANF_SCANSET(), ptr must be char *
+#define RINGSLICE_SCANF_ARG_CHAR(ptr)   { .type = RINGSLICE_SCANF_TYPE_CHAR, .to = { .c = (ptr) } }
+
+/// destination for RINGSLICE_SCANF_SLICE() and RINGSLICE_SCANF_SLICE_SCANSET(), ptr must be ringslice_t *
+#define RINGSLICE_SCANF_ARG_SLICE(ptr)  { .type = RINGSLICE_SCANF_TYPE_SLICE, .to = { .r = (ptr) } }
+
+/// destination for %hhd, ptr must be signed char *
+#define RINGSLICE_SCANF_ARG_SCHAR(ptr)  { .type = RINGSLICE_SCANF_TYPE_SCHAR, .to = { .hh = (ptr) } }
+/// destination for %hd, ptr must be short *
+#define RINGSLICE_SCANF_ARG_SHORT(ptr)  { .type = RINGSLICE_SCANF_TYPE_SHORT, .to = { .h = (ptr) } }
+/// destination for %ld, ptr must be long *
+#define RINGSLICE_SCANF_ARG_LONG(ptr)   { .type = RINGSLICE_SCANF_TYPE_LONG, .to = { .l = (ptr) } }
+/// destination for %lld, ptr must be long long *
+#define RINGSLICE_SCANF_ARG_LLONG(ptr)  { .type = RINGSLICE_SCANF_TYPE_LLONG, .to = { .ll = (ptr) } }
+/// destination for %jd, ptr must be intmax_t *
+#define RINGSLICE_SCANF_ARG_INTMAX(ptr) { .type = RINGSLICE_SCANF_TYPE_INTMAX, .to = { .j = (ptr) } }
+/// destination for %zd and %td, ptr must be ptrdiff_t *
+#define RINGSLICE_SCANF_ARG_PTRDIFF(ptr) { .type = RINGSLICE_SCANF_TYPE_PTRDIFF, .to = { .t = (ptr) } }
+/// destination for %hhu and %hhx, ptr must be unsigned char *
+#define RINGSLICE_SCANF_ARG_UCHAR(ptr)  { .type = RINGSLICE_SCANF_TYPE_UCHAR, .to = { .uhh = (ptr) } }
+/// destination for %hu and %hx, ptr must be unsigned short *
+#define RINGSLICE_SCANF_ARG_USHORT(ptr) { .type = RINGSLICE_SCANF_TYPE_USHORT, .to = { .uh = (ptr) } }
+/// destination for %lu and %lx, ptr must be unsigned long *
+#define RINGSLICE_SCANF_ARG_ULONG(ptr)  { .type = RINGSLICE_SCANF_TYPE_ULONG, .to = { .ul = (ptr) } }
+/// destination for %llu and %llx, ptr must be unsigned long long *
+#define RINGSLICE_SCANF_ARG_ULLONG(ptr) { .type = RINGSLICE_SCANF_TYPE_ULLONG, .to = { .ull = (ptr) } }
+/// destination for %ju and %jx, ptr must be uintmax_t *
+#define RINGSLICE_SCANF_ARG_UINTMAX(ptr) { .type = RINGSLICE_SCANF_TYPE_UINTMAX, .to = { .uj = (ptr) } }
+/// destination for %zu, %zx, %tu and %tx, ptr must be size_t *
+#define RINGSLICE_SCANF_ARG_SIZE(ptr)   { .type = RINGSLICE_SCANF_TYPE_SIZE, .to = { .z = (ptr) } }
+
+/// destination for %f, ptr must be float *
+#define RINGSLICE_SCANF_ARG_FLOAT(ptr)  { .type = RINGSLICE_SCANF_TYPE_FLOAT, .to = { .f = (ptr) } }
+/// destination for %lf, ptr must be double *
+#define RINGSLICE_SCANF_ARG_DOUBLE(ptr) { .type = RINGSLICE_SCANF_TYPE_DOUBLE, .to = { .lf = (ptr) } }
+/// destination for %q<bits>, ptr must be int32_t *
+#define RINGSLICE_SCANF_ARG_FIXED(ptr)  { .type = RINGSLICE_SCANF_TYPE_FIXED, .to = { .q = (ptr) } }
+
+/*!
+* Checks whether byte belongs to set
+* @param[in] set set instance
+* @param[in] byte byte to check
+*
+* @return true if byte belongs to set, otherwise false
+*
+*/
+RINGSLICE_INLINE bool ringslice_charset_contains(ringslice_charset_t const * const set, uint8_t byte) {
+    return (set->bits[byte >> 3] & (1u << (byte & 7u))) != 0;
+}
+
+/*!
+* Compiles scanset of scanf format to set of bytes
+* @param[out] me set instance
+* @param[in] scanset scanset without brackets, e.g. "^\"" or "a-z0-9"; a leading '^' negates set,
+*   ']' is a member if it comes first (after '^' if any), '-' between two bytes is a range
+*
+* @return number of parsed chars of scanset, it stops at the first ']' that is not a member
+*
+*/
+ringslice_cnt_t ringslice_charset_compile(ringslice_charset_t * const me, const char *scanset);
+
+/*!
+* Compiles format string to scanf program
+* @param[out] prog storage for program instructions
+* @param[in] capacity number of elements in prog storage;
+*   length of format string + 1 is always enough
+* @param[out] sets storage for sets of %[set] conversions, may be NULL if set_capacity is 0
+* @param[in] set_capacity number of elements in sets storage
+* @param[in] fmt format string, the same as for ringslice_scanf();
+*   literal parts are referenced by program, not copied
+*
+* @return number of instructions including the terminating one,
+    or -1 if format has unsupported conversion or prog or sets storage is too small
+*
+* @note Programs may also be written as constant tables with RINGSLICE_SCANF_xxx()
+*   initializers, e.g. format "+CREG: %d,%x" is
+*   {RINGSLICE_SCANF_LITERAL("+CREG:"), RINGSLICE_SCANF_SPACES(), RINGSLICE_SCANF_INT(),
+*   RINGSLICE_SCANF_LITERAL(","), RINGSLICE_SCANF_HEX(), RINGSLICE_SCANF_END()};
+*   ringslice_scanf_dump() generates such tables from format strings at build time.
+*
+*/
+ringslice_cnt_t ringslice_scanf_compile(ringslice_scanf_insn_t prog[], ringslice_cnt_t capacity,
+                                        ringslice_charset_t sets[], ringslice_cnt_t set_capacity, const char *fmt);
+
+/*!
+* Executes precompiled scanf program on ringslice
+* @param[in] rs ringslice instance
+* @param[in] prog program terminated by RINGSLICE_SCANF_OP_END instruction
+* @param[out] args destinations of conversions in order of appearance,
+*   type of each destination must match its conversion
+* @param[in] arg_cnt number of elements in args
+*
+* @return a number of receiving arguments succesfully assigned
+*
+*/
+int ringslice_scanf_exec(ringslice_t const * const rs, ringslice_scanf_insn_t const prog[],
+                         ringslice_scanf_arg_t const args[], int arg_cnt);
+
+/*!
+* Prints compiled scanf program as C source of constant tables
+* @param[in] prog program built with ringslice_scanf_compile()
+* @param[in] name name of emitted program array, sets of %[set] conversions are emitted as name_set0, name_set1...
+* @param[out] dst destination buffer for NUL-terminated text, may be NULL if dst_size is 0
+* @param[in] dst_size size of destination buffer
+*
+* @return length of the whole text (like snprintf()), text is truncated if it is not less than dst_size
+*
+* @note Host-side helper in ringslice_dump.c (requires snprintf()): compile formats
+*   on host as a build step, write the dump into a header and pass the emitted
+*   constant table to ringslice_scanf_exec(), so that target neither interprets
+*   format strings nor links ringslice_scanf_compile().
+*
+*/
+ringslice_cnt_t ringslice_scanf_dump(ringslice_scanf_insn_t const prog[], char const * name, char * dst, ringslice_cnt_t dst_size);
+
 /*!
 * @}
 */
@@ -0,0 +1,132 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Nikita Maltsev (aleph-five)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/*! @file
+* @brief Ring buffer filled by DMA in circular mode.
+*
+*/
+#include "ringslice_util.h"
+#include "ringslice.h"
+
+DBC_MODULE_NAME(RINGSLICE_MODULE)
+
+/*
+ * Private functions.
+ */
+
+/*!
+* Reads transfer complete flag that is not cleared by interrupt yet
+* @param[in] me ring buffer instance
+*
+* @return true if flag is set, false if it is clear or cannot be read
+*
+*/
+static bool dma_pending(ringslice_dma_t const *const me) {
+    return (me->pending != NULL) && me->pending(me->ctx);
+}
+
+/*!
+* Polls DMA write position
+* @param[in,out] me ring buffer instance, its written and head_idx are updated
+*
+*/
+static void dma_poll(ringslice_dma_t *const me) {
+    ringslice_seq_t laps;
+    ringslice_cnt_t remaining;
+    bool pending;
+
+    // re-read if transfer completes or its interrupt comes in between
+    do {
+        laps = me->laps;
+        pending = dma_pending(me);
+        remaining = me->remaining(me->ctx);
+    } while (laps != me->laps || pending != dma_pending(me));
+    DBC_ASSERT(910, 0 < remaining && remaining <= me->buf_size);
+
+    ringslice_cnt_t const pos = me->buf_size - remaining;
+    ringslice_seq_t written = (laps + (pending ? 1U : 0U)) * (ringslice_seq_t)me->buf_size + (ringslice_seq_t)pos;
+    if (me->pending == NULL && (int32_t)(written - me->written) < 0) {
+        written += (ringslice_seq_t)me->buf_size;  // DMA has wrapped, but its interrupt is still pending
+    }
+    me->written = written;
+    me->head_idx = pos;
+}
+
+/*
+ * Public functions.
+ */
+
+void ringslice_dma_init(ringslice_dma_t *const me, uint8_t *buf, ringslice_cnt_t buf_size,
+                        ringslice_dma_remaining_t remaining, ringslice_dma_pending_t pending, void *ctx) {
+    DBC_REQUIRE(911, me);
+    DBC_REQUIRE(912, buf);
+    DBC_REQUIRE(913, buf_size > 1);
+    DBC_REQUIRE(914, remaining);
+    me->buf = buf;
+    me->buf_size = buf_size;
+    me->remaining = remaining;
+    me->pending = pending;
+    me->ctx = ctx;
+    me->laps = 0;
+    me->written = 0;
+    me->tail = 0;
+    me->tail_idx = 0;
+    me->head_idx = 0;
+    me->overrun = false;
+}
+
+ringslice_t ringslice_dma_acquire_readable(ringslice_dma_t *const me) {
+    dma_poll(me);
+    ringslice_seq_t const len = me->written - me->tail;
+    if (len >= (ringslice_seq_t)me->buf_size) {
+        me->overrun = true;  // the oldest byte may be under DMA already, see ringslice_is_valid()
+    }
+    if (me->overrun) {
+        return ringslice_initializer(me->buf, me->buf_size, me->tail_idx, me->tail_idx);
+    }
+    ringslice_t rs = ringslice_len_initializer(me->buf, me->buf_size, me->tail_idx, (ringslice_cnt_t)len);
+#if RINGSLICE_CONFIG_SEQ
+    rs.seq = me->tail;
+#endif
+    return rs;
+}
+
+void ringslice_dma_release(ringslice_dma_t *const me, ringslice_cnt_t n) {
+    DBC_REQUIRE(915, 0 <= n && (ringslice_seq_t)n <= me->written - me->tail);
+    me->tail += (ringslice_seq_t)n;
+    me->tail_idx = ringslice_wrap(me->tail_idx + n, me->buf_size);
+}
+
+void ringslice_dma_resync(ringslice_dma_t *const me) {
+    me->tail = me->written;
+    me->tail_idx = me->head_idx;
+    me->overrun = false;
+}
+
+#if RINGSLICE_CONFIG_SEQ
+bool ringslice_dma_is_valid(ringslice_dma_t *const me, ringslice_t const *const rs) {
+    DBC_REQUIRE(916, rs->buf == me->buf);
+    dma_poll(me);
+    return ringslice_is_valid(rs, me->written);
+}
+#endif
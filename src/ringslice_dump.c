@@ -0,0 +1,231 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Nikita Maltsev (aleph-five)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/*! @file
+* @brief Dumps of multi-pattern automatons and scanf programs as C source (host side).
+*
+*/
+#include <stdarg.h>
+#include <stdio.h>
+#include "ringslice_util.h"
+#include "ringslice.h"
+
+DBC_MODULE_NAME(RINGSLICE_MODULE)
+
+/*
+ * Private functions.
+ */
+
+/*!
+* Appends formatted text to dump
+* @param[in,out] dst destination buffer
+* @param[in] dst_size size of destination buffer
+* @param[in,out] len length of text, counting text that did not fit
+* @param[in] fmt printf format of appended text
+*
+*/
+static void dump_append(char *dst, ringslice_cnt_t dst_size, ringslice_cnt_t *len, char const *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    size_t const room = (*len < dst_size) ? (size_t)(dst_size - *len) : 0;
+    int const n = vsnprintf((room != 0) ? &(dst[*len]) : NULL, room, fmt, args);
+    va_end(args);
+    if (n > 0) {
+        *len += n;
+    }
+}
+
+/*!
+* Appends bytes as C string literal
+* @param[in,out] dst destination buffer
+* @param[in] dst_size size of destination buffer
+* @param[in,out] len length of text, counting text that did not fit
+* @param[in] text bytes of literal
+* @param[in] n number of bytes
+*
+*/
+static void dump_literal(char *dst, ringslice_cnt_t dst_size, ringslice_cnt_t *len, char const *text, ringslice_cnt_t n) {
+    dump_append(dst, dst_size, len, "\"");
+    for (ringslice_cnt_t i = 0; i < n; i++) {
+        unsigned char const chr = (unsigned char)text[i];
+        if (chr == '"' || chr == '\\' || chr == '?') {
+            dump_append(dst, dst_size, len, "\\%c", chr);  // '?' is escaped against trigraphs
+        } else if (chr < 0x20 || chr > 0x7E) {
+            dump_append(dst, dst_size, len, "\\%03o", chr);  // three octal digits never merge with next byte
+        } else {
+            dump_append(dst, dst_size, len, "%c", chr);
+        }
+    }
+    dump_append(dst, dst_size, len, "\"");
+}
+
+/*!
+* Appends instruction as RINGSLICE_SCANF_xxx() initializer
+* @param[in,out] dst destination buffer
+* @param[in] dst_size size of destination buffer
+* @param[in,out] len length of text, counting text that did not fit
+* @param[in] insn instruction
+* @param[in] name name of program, sets are named name_set<index>
+* @param[in] set_idx index of set for instructions with set
+*
+*/
+static void dump_insn(char *dst, ringslice_cnt_t dst_size, ringslice_cnt_t *len,
+                      ringslice_scanf_insn_t const *insn, char const *name, ringslice_cnt_t set_idx) {
+    static char const *const ops[] = {
+        "RINGSLICE_SCANF_OP_END", "RINGSLICE_SCANF_OP_LITERAL", "RINGSLICE_SCANF_OP_SPACES",
+        "RINGSLICE_SCANF_OP_INT", "RINGSLICE_SCANF_OP_UINT", "RINGSLICE_SCANF_OP_HEX",
+        "RINGSLICE_SCANF_OP_CHARS", "RINGSLICE_SCANF_OP_STRING", "RINGSLICE_SCANF_OP_SCANSET",
+        "RINGSLICE_SCANF_OP_SLICE", "RINGSLICE_SCANF_OP_SLICE_SCANSET", "RINGSLICE_SCANF_OP_FLOAT",
+        "RINGSLICE_SCANF_OP_FIXED",
+    };
+    static char const *const lens[] = {
+        "RINGSLICE_SCANF_LEN_NONE", "RINGSLICE_SCANF_LEN_HH", "RINGSLICE_SCANF_LEN_H", "RINGSLICE_SCANF_LEN_L",
+        "RINGSLICE_SCANF_LEN_LL", "RINGSLICE_SCANF_LEN_J", "RINGSLICE_SCANF_LEN_Z", "RINGSLICE_SCANF_LEN_T",
+    };
+    unsigned const width = insn->width;
+
+    switch (insn->op) {
+    case RINGSLICE_SCANF_OP_LITERAL:
+        dump_append(dst, dst_size, len, "RINGSLICE_SCANF_LITERAL(");
+        dump_literal(dst, dst_size, len, insn->data.text, (ringslice_cnt_t)width);
+        dump_append(dst, dst_size, len, ")");
+        return;
+    case RINGSLICE_SCANF_OP_SPACES:
+        dump_append(dst, dst_size, len, "RINGSLICE_SCANF_SPACES()");
+        return;
+    case RINGSLICE_SCANF_OP_CHARS:
+        dump_append(dst, dst_size, len, "RINGSLICE_SCANF_CHARS(%u)", width);
+        return;
+    case RINGSLICE_SCANF_OP_STRING:
+        dump_append(dst, dst_size, len, "RINGSLICE_SCANF_STRING(%u)", width);
+        return;
+    case RINGSLICE_SCANF_OP_SCANSET:
+        dump_append(dst, dst_size, len, "RINGSLICE_SCANF_SCANSET(%u, &%s_set%ld)", width, name, (long)set_idx);
+        return;
+    case RINGSLICE_SCANF_OP_SLICE:
+        dump_append(dst, dst_size, len, "RINGSLICE_SCANF_SLICE(%u)", width);
+        return;
+    case RINGSLICE_SCANF_OP_SLICE_SCANSET:
+        dump_append(dst, dst_size, len, "RINGSLICE_SCANF_SLICE_SCANSET(%u, &%s_set%ld)", width, name, (long)set_idx);
+        return;
+    case RINGSLICE_SCANF_OP_END:
+        dump_append(dst, dst_size, len, "RINGSLICE_SCANF_END()");
+        return;
+    default:
+        break;
+    }
+
+    // conversions with length modifier and width
+    DBC_ASSERT(455, insn->op < sizeof(ops) / sizeof(ops[0]));
+    if (width == 0 && insn->len == RINGSLICE_SCANF_LEN_NONE) {
+        switch (insn->op) {
+        case RINGSLICE_SCANF_OP_INT:
+            dump_append(dst, dst_size, len, "RINGSLICE_SCANF_INT()");
+            return;
+        case RINGSLICE_SCANF_OP_UINT:
+            dump_append(dst, dst_size, len, "RINGSLICE_SCANF_UINT()");
+            return;
+        case RINGSLICE_SCANF_OP_HEX:
+            dump_append(dst, dst_size, len, "RINGSLICE_SCANF_HEX()");
+            return;
+        case RINGSLICE_SCANF_OP_FLOAT:
+            dump_append(dst, dst_size, len, "RINGSLICE_SCANF_FLOAT()");
+            return;
+        default:
+            break;
+        }
+    }
+    if (width == 0 && insn->op == RINGSLICE_SCANF_OP_FLOAT && insn->len == RINGSLICE_SCANF_LEN_L) {
+        dump_append(dst, dst_size, len, "RINGSLICE_SCANF_DOUBLE()");
+        return;
+    }
+    if (width == 0 && insn->op == RINGSLICE_SCANF_OP_FIXED) {
+        dump_append(dst, dst_size, len, "RINGSLICE_SCANF_FIXED(%u)", (unsigned)insn->len);
+        return;
+    }
+    if (insn->op == RINGSLICE_SCANF_OP_FIXED) {
+        dump_append(dst, dst_size, len, "RINGSLICE_SCANF_CONV(%s, %u, %u)", ops[insn->op], (unsigned)insn->len, width);
+        return;
+    }
+    DBC_ASSERT(457, insn->len < sizeof(lens) / sizeof(lens[0]));
+    dump_append(dst, dst_size, len, "RINGSLICE_SCANF_CONV(%s, %s, %u)", ops[insn->op], lens[insn->len], width);
+}
+
+/*
+ * Public functions.
+ */
+
+ringslice_cnt_t ringslice_scanf_dump(ringslice_scanf_insn_t const prog[], char const *name, char *dst, ringslice_cnt_t dst_size) {
+    DBC_REQUIRE(453, prog);
+    DBC_REQUIRE(454, name);
+    DBC_REQUIRE(456, dst || dst_size == 0);
+    ringslice_cnt_t len = 0;
+    ringslice_cnt_t set_cnt = 0;
+
+    // sets first, so that instructions may refer to them
+    for (ringslice_scanf_insn_t const *insn = prog; insn->op != RINGSLICE_SCANF_OP_END; insn++) {
+        if (insn->op != RINGSLICE_SCANF_OP_SCANSET && insn->op != RINGSLICE_SCANF_OP_SLICE_SCANSET) {
+            continue;
+        }
+        dump_append(dst, dst_size, &len, "static ringslice_charset_t const %s_set%ld = {{", name, (long)set_cnt++);
+        for (int i = 0; i < (int)sizeof(insn->data.set->bits); i++) {
+            dump_append(dst, dst_size, &len, "%s0x%02X", (i == 0) ? "" : ", ", (unsigned)insn->data.set->bits[i]);
+        }
+        dump_append(dst, dst_size, &len, "}};\n");
+    }
+
+    dump_append(dst, dst_size, &len, "static ringslice_scanf_insn_t const %s[] = {\n", name);
+    set_cnt = 0;
+    for (ringslice_scanf_insn_t const *insn = prog;; insn++) {
+        dump_append(dst, dst_size, &len, "    ");
+        dump_insn(dst, dst_size, &len, insn, name, set_cnt);
+        dump_append(dst, dst_size, &len, ",\n");
+        if (insn->op == RINGSLICE_SCANF_OP_SCANSET || insn->op == RINGSLICE_SCANF_OP_SLICE_SCANSET) {
+            ++set_cnt;
+        }
+        if (insn->op == RINGSLICE_SCANF_OP_END) {
+            break;
+        }
+    }
+    dump_append(dst, dst_size, &len, "};\n");
+    return len;
+}
+
+ringslice_cnt_t ringslice_multi_dump(ringslice_multi_t const *const me, char const *name, char *dst, ringslice_cnt_t dst_size) {
+    DBC_REQUIRE(510, me);
+    DBC_REQUIRE(511, name);
+    DBC_REQUIRE(512, dst || dst_size == 0);
+    ringslice_cnt_t len = 0;
+
+    dump_append(dst, dst_size, &len, "static ringslice_multi_node_t const %s_nodes[%ld] = {\n", name, (long)me->node_cnt);
+    for (ringslice_cnt_t i = 0; i < me->node_cnt; i++) {
+        ringslice_multi_node_t const *const node = &(me->nodes[i]);
+        dump_append(dst, dst_size, &len, "    {%u, %u, %u, %u, %u, %d, 0x%02X},\n",
+                    (unsigned)node->child, (unsigned)node->sibling, (unsigned)node->fail, (unsigned)node->dict,
+                    (unsigned)node->depth, (int)node->pattern, (unsigned)node->byte);
+    }
+    dump_append(dst, dst_size, &len, "};\n");
+    dump_append(dst, dst_size, &len, "static ringslice_multi_t const %s = {%s_nodes, %ld, %ld};\n",
+                name, name, (long)me->node_cnt, (long)me->max_len);
+    return len;
+}
@@ -0,0 +1,149 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Nikita Maltsev (aleph-five)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/*! @file
+* @brief Binary framing (length prefix, COBS, SLIP/HDLC) for ringslices.
+*
+*/
+#include "ringslice_util.h"
+#include "ringslice.h"
+
+DBC_MODULE_NAME(RINGSLICE_MODULE)
+
+/*
+ * Public functions.
+ */
+
+ringslice_cnt_t ringslice_frame_prefixed(ringslice_t const *const me, ringslice_prefix_t prefix, ringslice_cnt_t max_len,
+                                         ringslice_t *const payload) {
+    DBC_REQUIRE(700, 0 <= max_len);
+    DBC_REQUIRE(701, payload);
+    static uint8_t const prefix_size[] = {
+        [RINGSLICE_PREFIX_U8] = 1,
+        [RINGSLICE_PREFIX_U16_LE] = 2,
+        [RINGSLICE_PREFIX_U16_BE] = 2,
+        [RINGSLICE_PREFIX_U32_LE] = 4,
+        [RINGSLICE_PREFIX_U32_BE] = 4,
+    };
+    DBC_REQUIRE(702, (unsigned)prefix < sizeof(prefix_size));
+    ringslice_cnt_t const rs_len = ringslice_len(me);
+    ringslice_cnt_t const size = prefix_size[prefix];
+    if (rs_len < size) {
+        return 0;
+    }
+
+    bool const big_endian = (prefix == RINGSLICE_PREFIX_U16_BE || prefix == RINGSLICE_PREFIX_U32_BE);
+    uint32_t len = 0;
+    for (ringslice_cnt_t i = 0; i < size; i++) {
+        uint32_t const byte = ringslice_nth_byte(me, i);
+        len = big_endian ? ((len << 8) | byte) : (len | (byte << (8 * i)));
+    }
+    if (len > (uint32_t)max_len) {
+        return -1;
+    }
+    if ((uint32_t)(rs_len - size) < len) {
+        return 0;
+    }
+
+    ringslice_cnt_t const frame_len = size + (ringslice_cnt_t)len;
+    *payload = ringslice_rel_slice(me, size, frame_len);
+    return frame_len;
+}
+
+ringslice_cnt_t ringslice_frame_delimited(ringslice_t const *const me, uint8_t delim, ringslice_t *const frame) {
+    DBC_REQUIRE(703, frame);
+    ringslice_cnt_t const pos = ringslice_memchr(me, delim);
+    if (pos < 0) {
+        return 0;
+    }
+    *frame = ringslice_rel_slice(me, 0, pos);
+    return pos + 1;
+}
+
+ringslice_cnt_t ringslice_cobs_decode(ringslice_t const *const frame, uint8_t *dst, ringslice_cnt_t dst_size) {
+    DBC_REQUIRE(704, dst || dst_size == 0);
+    ringslice_cnt_t const len = ringslice_len(frame);
+    ringslice_cnt_t pos = 0;
+    ringslice_cnt_t out = 0;
+
+    while (pos < len) {
+        uint8_t const code = ringslice_nth_byte(frame, pos++);
+        ringslice_cnt_t const run = (ringslice_cnt_t)code - 1;
+        if (code == 0 || run > len - pos || run > dst_size - out) {
+            return -1;
+        }
+        (void)ringslice_copy_to_offset(frame, pos, &dst[out], run);
+        pos += run;
+        out += run;
+
+        // a block shorter than 254 bytes stands for data followed by zero, except for the last one
+        if (code != 0xFF && pos < len) {
+            if (out >= dst_size) {
+                return -1;
+            }
+            dst[out++] = 0;
+        }
+    }
+    return out;
+}
+
+ringslice_cnt_t ringslice_unstuff(ringslice_t const *const frame, ringslice_stuffing_t const *const stuffing,
+                                  uint8_t *dst, ringslice_cnt_t dst_size) {
+    DBC_REQUIRE(705, stuffing);
+    DBC_REQUIRE(706, dst || dst_size == 0);
+    ringslice_cnt_t const len = ringslice_len(frame);
+    ringslice_cnt_t pos = 0;
+    ringslice_cnt_t out = 0;
+
+    while (pos < len) {
+        // copy run of bytes up to escape byte at once
+        ringslice_t const rest = ringslice_subslice(frame, pos, len);
+        ringslice_cnt_t const esc_pos = ringslice_memchr(&rest, stuffing->esc);
+        ringslice_cnt_t const run = (esc_pos < 0) ? (len - pos) : esc_pos;
+        if (run > dst_size - out) {
+            return -1;
+        }
+        (void)ringslice_copy_to_offset(frame, pos, &dst[out], run);
+        pos += run;
+        out += run;
+        if (esc_pos < 0) {
+            break;
+        }
+
+        pos++;
+        if (pos >= len || out >= dst_size) {
+            return -1;
+        }
+        uint8_t const byte = ringslice_nth_byte(frame, pos++);
+        if (byte == stuffing->esc_flag) {
+            dst[out++] = stuffing->flag;
+        } else if (byte == stuffing->esc_esc) {
+            dst[out++] = stuffing->esc;
+        } else if (stuffing->esc_xor != 0) {
+            dst[out++] = byte ^ stuffing->esc_xor;
+        } else {
+            return -1;
+        }
+    }
+    return out;
+}
@@ -0,0 +1,79 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Nikita Maltsev (aleph-five)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/*! @file
+* @brief Ring buffer mapped twice at adjacent addresses (Linux memfd_create).
+*
+*/
+#define _GNU_SOURCE  // memfd_create()
+#include "ringslice_util.h"
+#include "ringslice.h"
+
+#if RINGSLICE_CONFIG_MIRROR
+#include <sys/mman.h>
+#include <unistd.h>
+
+DBC_MODULE_NAME(RINGSLICE_MODULE)
+
+/*
+ * Public functions.
+ */
+
+bool ringslice_mirror_init(ringslice_mirror_t *const me, ringslice_cnt_t buf_size) {
+    DBC_REQUIRE(920, me);
+    DBC_REQUIRE(921, buf_size > 0 && buf_size % sysconf(_SC_PAGESIZE) == 0);
+    size_t const size = (size_t)buf_size;
+    int const fd = memfd_create("ringslice", MFD_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    // reserve address range for both views, then replace its halves by views of the same memory
+    uint8_t *buf = MAP_FAILED;
+    if (ftruncate(fd, (off_t)size) == 0) {
+        buf = mmap(NULL, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+    bool ok = (buf != MAP_FAILED);
+    for (int i = 0; ok && i < 2; i++) {
+        ok = (mmap(&(buf[i * size]), size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED);
+    }
+    if (!ok && buf != MAP_FAILED) {
+        (void)munmap(buf, 2 * size);
+    }
+    (void)close(fd);  // mappings keep memory alive
+
+    if (ok) {
+        me->buf = buf;
+        me->buf_size = buf_size;
+    }
+    return ok;
+}
+
+void ringslice_mirror_deinit(ringslice_mirror_t *const me) {
+    DBC_REQUIRE(922, me->buf);
+    (void)munmap(me->buf, 2 * (size_t)me->buf_size);
+    me->buf = NULL;
+    me->buf_size = 0;
+}
+
+#endif
@@ -0,0 +1,185 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Nikita Maltsev (aleph-five)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/*! @file
+* @brief Multi-pattern search (Aho-Corasick automaton) for ringslices.
+*
+*/
+#include "ringslice_util.h"
+#include "ringslice.h"
+
+DBC_MODULE_NAME(RINGSLICE_MODULE)
+
+/*
+ * Private functions.
+ */
+
+/*!
+* Finds child node by byte on its edge
+* @param[in] nodes nodes of automaton
+* @param[in] state index of parent node
+* @param[in] byte byte on edge
+*
+* @return index of child node, 0 if there is no such child
+*
+*/
+static uint16_t multi_child(ringslice_multi_node_t const nodes[], uint16_t state, uint8_t byte) {
+    uint16_t child = nodes[state].child;
+    while (child != 0 && nodes[child].byte != byte) {
+        child = nodes[child].sibling;
+    }
+    return child;
+}
+
+/*!
+* Makes transition of automaton following fail links on mismatch
+* @param[in] nodes nodes of automaton
+* @param[in] state index of current node
+* @param[in] byte next byte of text
+*
+* @return index of the next node
+*
+*/
+static uint16_t multi_step(ringslice_multi_node_t const nodes[], uint16_t state, uint8_t byte) {
+    for (;;) {
+        uint16_t child = multi_child(nodes, state, byte);
+        if (child != 0 || state == 0) {
+            return child;
+        }
+        state = nodes[state].fail;
+    }
+}
+
+/*
+ * Public functions.
+ */
+
+bool ringslice_multi_build(ringslice_multi_t *const me, ringslice_multi_node_t nodes[], ringslice_cnt_t capacity,
+                           char const *const patterns[], ringslice_cnt_t pattern_cnt) {
+    DBC_REQUIRE(500, me);
+    DBC_REQUIRE(501, nodes);
+    DBC_REQUIRE(502, 0 < capacity && capacity <= UINT16_MAX);
+    DBC_REQUIRE(503, 0 <= pattern_cnt && pattern_cnt <= INT16_MAX);
+    ringslice_multi_node_t const root = {
+        .child = 0,
+        .sibling = 0,
+        .fail = 0,
+        .dict = 0,
+        .depth = 0,
+        .pattern = -1,
+        .byte = 0,
+    };
+    ringslice_cnt_t node_cnt = 1;
+    ringslice_cnt_t max_len = 0;
+    nodes[0] = root;
+
+    // trie of patterns
+    for (ringslice_cnt_t p = 0; p < pattern_cnt; p++) {
+        uint16_t state = 0;
+        for (uint8_t const *chr = (uint8_t const *)patterns[p]; *chr != '\0'; chr++) {
+            uint16_t next = multi_child(nodes, state, *chr);
+            if (next == 0) {
+                if (node_cnt >= capacity) {
+                    return false;
+                }
+                next = (uint16_t)node_cnt++;
+                nodes[next] = root;
+                nodes[next].sibling = nodes[state].child;
+                nodes[next].depth = (uint16_t)(nodes[state].depth + 1);
+                nodes[next].byte = *chr;
+                nodes[state].child = next;
+            }
+            state = next;
+        }
+        if (state != 0 && nodes[state].pattern < 0) {
+            nodes[state].pattern = (int16_t)p;
+        }
+        if (nodes[state].depth > max_len) {
+            max_len = nodes[state].depth;
+        }
+    }
+
+    // fail and dictionary links, level by level so that links of shallower nodes are ready
+    for (ringslice_cnt_t depth = 1; depth <= max_len; depth++) {
+        for (ringslice_cnt_t parent = 0; parent < node_cnt; parent++) {
+            if (nodes[parent].depth != depth - 1) {
+                continue;
+            }
+            for (uint16_t child = nodes[parent].child; child != 0; child = nodes[child].sibling) {
+                uint16_t fail = (parent == 0) ? 0 : multi_step(nodes, nodes[parent].fail, nodes[child].byte);
+                nodes[child].fail = fail;
+                nodes[child].dict = (nodes[fail].pattern >= 0) ? fail : nodes[fail].dict;
+            }
+        }
+    }
+
+    *me = ringslice_multi_initializer(nodes, node_cnt, max_len);
+    return true;
+}
+
+ringslice_multi_match_t ringslice_find_multi(ringslice_t const *const me, ringslice_multi_t const *const multi) {
+    ringslice_multi_match_t result = {
+        .match = ringslice_rel_slice(me, 0, 0),  // initialize with empty slice
+        .pattern = -1,
+    };
+    ringslice_multi_node_t const *const nodes = multi->nodes;
+    ringslice_view_t const view = ringslice_split(me);
+    ringslice_cnt_t best_start = -1;
+    ringslice_cnt_t best_len = 0;
+    ringslice_cnt_t pos = 0;  // relative index after the last processed byte
+    uint16_t state = 0;
+
+    for (int s = 0; s < 2; s++) {
+        uint8_t const *chr = view.seg[s];
+        uint8_t const *const end = &(view.seg[s][view.seg_len[s]]);
+        for (; chr != end; chr++) {
+            state = multi_step(nodes, state, *chr);
+            pos++;
+
+            // the longest pattern ending here starts the leftmost
+            uint16_t out = (nodes[state].pattern >= 0) ? state : nodes[state].dict;
+            if (out != 0) {
+                ringslice_cnt_t len = nodes[out].depth;
+                ringslice_cnt_t start = pos - len;
+                if (best_start < 0 || start < best_start || (start == best_start && len > best_len)) {
+                    best_start = start;
+                    best_len = len;
+                    result.pattern = nodes[out].pattern;
+                }
+            }
+
+            // no match that starts at best_start or before it can end after this position
+            if (best_start >= 0 && pos >= best_start + multi->max_len) {
+                break;
+            }
+        }
+        if (chr != end) {
+            break;
+        }
+    }
+
+    if (best_start >= 0) {
+        result.match = ringslice_subslice(me, best_start, best_start + best_len);
+    }
+    return result;
+}
@@ -29,17 +29,76 @@
 * @ref https://github.com/eliangidoni/mfmt.git
 *
 */
+#include <limits.h>
 #include <stdarg.h>
 #include <stddef.h>
+#include <string.h>
 #include "ringslice_util.h"
 #include "ringslice.h"
 
 DBC_MODULE_NAME(RINGSLICE_MODULE)
 
+/*
+ * Private types.
+ */
+
+/// read position in ringslice that walks its contiguous segments
+typedef struct {
+    uint8_t const *ptr;         ///< pointer to the current byte
+    uint8_t const *end;         ///< end of the current segment
+    uint8_t const *next;        ///< start of the next segment, NULL if the current segment is the last one
+    uint8_t const *next_end;    ///< end of the next segment
+} wa_cursor_t;
+
 /*
  * Private functions.
  */
 
+/*!
+* Initializes cursor at the beginning of ringslice
+* @param[in] rs ringslice instance
+*
+* @return cursor instance
+*
+*/
+static wa_cursor_t wa_cursor_init(ringslice_t const *const rs) {
+    ringslice_view_t const view = ringslice_split(rs);
+    wa_cursor_t cursor = {
+        .ptr = view.seg[0],
+        .end = &(view.seg[0][view.seg_len[0]]),
+        .next = (view.seg_len[1] != 0) ? view.seg[1] : NULL,
+        .next_end = &(view.seg[1][view.seg_len[1]]),
+    };
+    return cursor;
+}
+
+/*!
+* Checks whether cursor reached the end of ringslice
+* @param[in] c cursor instance
+*
+* @return true if there are no more bytes, otherwise false
+*
+*/
+static bool wa_at_end(wa_cursor_t c) {
+    return (c.ptr == c.end);
+}
+
+/*!
+* Moves cursor to the next byte, switching to the next segment at the wrap point
+* @param[in] c cursor instance, must not be at the end
+*
+* @return cursor at the next byte
+*
+*/
+static wa_cursor_t wa_advance(wa_cursor_t c) {
+    if (++c.ptr == c.end && c.next != NULL) {
+        c.ptr = c.next;
+        c.end = c.next_end;
+        c.next = NULL;
+    }
+    return c;
+}
+
 /*!
 * Checks whether the character is a whitespace
 * @param[in] c character to check
@@ -54,23 +113,16 @@ static int is_space(char c) {
 
 /*!
 * Skips all the whitespaces in the ringslice
-* @param[in] first index of first byte in ringslice
-* @param[in] last index after last byte in ringslice 
-* @param[in] buf pointer to buffer of ringslice
-* @param[in] size buffer size
+* @param[in] c cursor
 *
-* @return first encountered index of byte
-    in the ringslice that is not a space
+* @return cursor at the first byte that is not a space
 *
 */
-static ringslice_cnt_t wa_skip_spaces(ringslice_cnt_t first, 
-                                        ringslice_cnt_t const last,
-                                        uint8_t const buf[],
-                                        ringslice_cnt_t size) {
-    while (is_space((char)buf[first]) && (first != last)) {
-        first = ringslice_index_shift_wrap_around(first, 1, size);
+static inline wa_cursor_t wa_skip_spaces(wa_cursor_t c) {
+    while (!wa_at_end(c) && is_space((char)*c.ptr)) {
+        c = wa_advance(c);
     }
-    return first;
+    return c;
 }
 
 /*!
@@ -88,78 +140,174 @@ static char * skip_spaces(const char *str) {
     return (char *)str;
 }
 
+/*!
+* Moves cursor forward by several bytes of the current segment
+* @param[in] c cursor instance
+* @param[in] n number of bytes, 0 < n <= c.end - c.ptr
+*
+* @return cursor after skipped bytes
+*
+*/
+static wa_cursor_t wa_skip(wa_cursor_t c, ringslice_cnt_t n) {
+    c.ptr = &c.ptr[n - 1];
+    return wa_advance(c);
+}
+
+/*!
+* Limits cursor to the next width bytes, for conversions with maximum field width
+* @param[in] c cursor
+* @param[in] width maximum number of bytes to read, not 0
+*
+* @return cursor that reaches its end after width bytes at the latest
+*
+*/
+static wa_cursor_t wa_limit(wa_cursor_t c, unsigned int width) {
+    size_t const head = (size_t)(c.end - c.ptr);
+    if (width <= head) {
+        c.end = &c.ptr[width];
+        c.next = NULL;
+    } else if (c.next != NULL && width - head < (size_t)(c.next_end - c.next)) {
+        c.next_end = &c.next[width - head];
+    }
+    return c;
+}
+
+/*!
+* Restores segment ends of cursor moved within limited one
+* @param[in] c cursor passed to wa_limit()
+* @param[in] lim cursor returned by wa_limit()
+* @param[in] r position reached by reading from lim
+*
+* @return cursor at r that can read up to the end of ringslice
+*
+*/
+static wa_cursor_t wa_unlimit(wa_cursor_t c, wa_cursor_t lim, wa_cursor_t r) {
+    if (lim.next == NULL && c.next != NULL) {
+        // the limit is in the first segment, r may have stopped exactly at its end
+        c.ptr = r.ptr;
+        if (c.ptr == c.end) {
+            c.ptr = c.next;
+            c.end = c.next_end;
+            c.next = NULL;
+        }
+        return c;
+    }
+    if (r.next != NULL) {
+        r.next_end = c.next_end;
+    } else {
+        r.end = (c.next != NULL) ? c.next_end : c.end;
+    }
+    return r;
+}
+
+/*!
+* Converts 8 decimal digits a machine word at a time (SWAR)
+* @param[in] ptr pointer to 8 bytes
+* @param[out] out value of digits
+*
+* @return true if all 8 bytes are decimal digits, otherwise false
+*
+*/
+static bool swar_8digits(uint8_t const *ptr, uint32_t *out) {
+    uint64_t val = 0;
+    for (int i = 7; i >= 0; i--) {
+        val = (val << 8) | ptr[i];  // the first digit goes to the lowest byte on any target
+    }
+    if ((((val & 0xF0F0F0F0F0F0F0F0U) | (((val + 0x0606060606060606U) & 0xF0F0F0F0F0F0F0F0U) >> 4)) !=
+         0x3333333333333333U)) {
+        return false;
+    }
+    val = ((val & 0x0F0F0F0F0F0F0F0FU) * ((10U << 8) + 1U)) >> 8;            // pairs of digits
+    val = ((val & 0x00FF00FF00FF00FFU) * ((100U << 16) + 1U)) >> 16;        // groups of 4 digits
+    *out = (uint32_t)(((val & 0x0000FFFF0000FFFFU) * ((10000ULL << 32) + 1U)) >> 32);
+    return true;
+}
+
+/*!
+* Converts decimal digits to unsigned value with overflow check
+* @param[in] c cursor
+* @param[in] limit maximum allowed value
+* @param[out] out pointer to out value
+*
+* @return cursor after the last read and processed char
+    or c on error (no digits or value is greater than limit).
+*
+*/
+static inline wa_cursor_t wa_digits_to_unsigned(wa_cursor_t const c, uintmax_t limit, uintmax_t *out) {
+    wa_cursor_t cur = c;
+    uintmax_t value = 0;
+    uint32_t chunk;
+    // 8 digits at a time while they are in the current segment, value * 10^8 + 99999999 can't wrap
+    while (cur.end - cur.ptr >= 8 && value <= (UINTMAX_MAX - 99999999U) / 100000000U &&
+           swar_8digits(cur.ptr, &chunk)) {
+        value = (value * 100000000U) + chunk;
+        cur = wa_skip(cur, 8);
+    }
+    // the rest digit by digit
+    while (!wa_at_end(cur) && *cur.ptr >= '0' && *cur.ptr <= '9') {
+        unsigned int digit = (unsigned int)(*cur.ptr - '0');
+        if (value >= UINTMAX_MAX / 10U && (value > UINTMAX_MAX / 10U || digit > UINTMAX_MAX % 10U)) {
+            return c;
+        }
+        value = (value * 10U) + digit;
+        cur = wa_advance(cur);
+    }
+    if (cur.ptr == c.ptr || value > limit) {
+        return c;
+    }
+    *out = value;
+    return cur;
+}
+
 /*!
 * Converts decimal string to signed value
-* @param[in] first index of first byte in ringslice
-* @param[in] last index after last byte in ringslice 
-* @param[in] buf pointer to buffer of ringslice
-* @param[in] size buffer size
+* @param[in] c cursor
+* @param[in] min minimum allowed value
+* @param[in] max maximum allowed value
 * @param[out] out pointer to out value
 *
-* @return an index after the last read and processed char
-    or first on error.
-*
-*/
-static ringslice_cnt_t wa_dec_to_signed(ringslice_cnt_t const first,
-                                            ringslice_cnt_t const last,
-                                            uint8_t const buf[],
-                                            ringslice_cnt_t size,
-                                            long *out) {
-    ringslice_cnt_t cur = wa_skip_spaces(first, last, buf, size);
-    long value = 0;
-    int isneg = 0, isempty = 1;
-    if (buf[cur] == '+') {
-        cur = ringslice_index_shift_wrap_around(cur, 1, size);
-    } else if (buf[cur] == '-') {
-        cur = ringslice_index_shift_wrap_around(cur, 1, size);
+* @return cursor after the last read and processed char
+    or c on error.
+*
+*/
+static wa_cursor_t wa_dec_to_signed(wa_cursor_t const c, intmax_t min, intmax_t max, intmax_t *out) {
+    wa_cursor_t cur = wa_skip_spaces(c);
+    uintmax_t value = 0;
+    int isneg = 0;
+    if (!wa_at_end(cur) && *cur.ptr == '+') {
+        cur = wa_advance(cur);
+    } else if (!wa_at_end(cur) && *cur.ptr == '-') {
+        cur = wa_advance(cur);
         isneg = 1;
     }
-    while (cur != last && buf[cur] >= '0' && buf[cur] <= '9') {
-        value = (value * 10) + (buf[cur] - '0');
-        isempty = 0;
-        cur = ringslice_index_shift_wrap_around(cur, 1, size);
-    }
-    if (isempty) {
-        return first;
+    uintmax_t const limit = isneg ? ((uintmax_t)(-(min + 1)) + 1U) : (uintmax_t)max;
+    wa_cursor_t const digits = cur;
+    cur = wa_digits_to_unsigned(digits, limit, &value);
+    if (cur.ptr == digits.ptr) {
+        return c;
     }
-    if (isneg) {
-        *out = -value;
+    if (isneg && value != 0U) {
+        *out = -(intmax_t)(value - 1U) - 1;
     } else {
-        *out = value;
+        *out = (intmax_t)value;
     }
     return cur;
 }
 
 /*!
 * Converts decimal string to unsigned value
-* @param[in] first index of first byte in ringslice
-* @param[in] last index after last byte in ringslice 
-* @param[in] buf pointer to buffer of ringslice
-* @param[in] size buffer size
+* @param[in] c cursor
+* @param[in] limit maximum allowed value
 * @param[out] out pointer to out value
 *
-* @return an index after the last read and processed char
-    or first on error.
+* @return cursor after the last read and processed char
+    or c on error.
 *
 */
-static ringslice_cnt_t wa_dec_to_unsigned(ringslice_cnt_t const first,
-                                            ringslice_cnt_t const last,
-                                            uint8_t const buf[],
-                                            ringslice_cnt_t size,
-                                            unsigned long *out) {
-    ringslice_cnt_t cur = wa_skip_spaces(first, last, buf, size);
-    unsigned long value = 0;
-    int isempty = 1;
-    while (cur != last && buf[cur] >= '0' && buf[cur] <= '9') {
-        value = (value * 10) + (buf[cur] - '0');
-        isempty = 0;
-        cur = ringslice_index_shift_wrap_around(cur, 1, size);
-    }
-    if (isempty) {
-        return first;
-    }
-    *out = value;
-    return cur;
+static wa_cursor_t wa_dec_to_unsigned(wa_cursor_t const c, uintmax_t limit, uintmax_t *out) {
+    wa_cursor_t const cur = wa_skip_spaces(c);
+    wa_cursor_t const next = wa_digits_to_unsigned(cur, limit, out);
+    return (next.ptr == cur.ptr) ? c : next;
 }
 
 /* Returns a pointer after the last read char, or 'str' on error. */
@@ -180,124 +328,650 @@ dec_to_unsigned(const char *str, unsigned long *out) {
     return (char *)cur;
 }
 
-/* Returns an index after the last read char, or first on error. */
-// static ringslice_cnt_t
-// wa_hex_to_signed(ringslice_cnt_t const first, ringslice_cnt_t const last, uint8_t const buf[], ringslice_cnt_t size, long *out)
-// {
-//         ringslice_cnt_t cur = wa_skip_spaces(first, last, buf, size);
-//         if(last == cur || last == ringslice_index_shift_wrap_around(cur, 1, size))
-//         {
-//                 return first;
-//         }
-//         long value = 0;
-//         int isneg = 0, isempty = 1;
-//         if (buf[cur] == '+'){
-//                 cur = ringslice_index_shift_wrap_around(cur, 1, size);
-//         }else if(buf[cur] == '-'){
-//                 cur = ringslice_index_shift_wrap_around(cur, 1, size);
-//                 isneg = 1;
-//         }
-//         if (buf[cur] == '0'
-//                 && ringslice_index_shift_wrap_around(cur, 1, size) != last
-//                 && buf[ringslice_index_shift_wrap_around(cur, 1, size)] == 'x'){
-//                         cur = ringslice_index_shift_wrap_around(cur, 2, size);
-//         }
-//         while (cur != last){
-//                 if(buf[cur] >= '0' && buf[cur] <= '9'){
-//                         value = (value * 16) + (buf[cur] - '0');
-//                 }else if (buf[cur] >= 'a' && buf[cur] <= 'f'){
-//                         value = (value * 16) + 10 + (buf[cur] - 'a');
-//                 }else if (buf[cur] >= 'A' && buf[cur] <= 'F'){
-//                         value = (value * 16) + 10 + (buf[cur] - 'A');
-//                 }else{
-//                         break;
-//                 }
-//                 isempty = 0;
-//                 cur = ringslice_index_shift_wrap_around(cur, 1, size);
-//         }
-//         if (isempty){
-//                 return first;
-//         }
-//         if (isneg){
-//                 *out = -value;
-//         }else{
-//                 *out = value;
-//         }
-//         return cur;
-// }
-
 /*!
 * Converts hex string to unsigned value
-* @param[in] first index of first byte in ringslice
-* @param[in] last index after last byte in ringslice 
-* @param[in] buf pointer to buffer of ringslice
-* @param[in] size buffer size
+* @param[in] c cursor
+* @param[in] limit maximum allowed value
 * @param[out] out pointer to out value
 *
-* @return an index after the last read and processed char
-    or first on error.
+* @return cursor after the last read and processed char
+    or c on error. A "0x" prefix without hex digits after it
+    yields 0 with the cursor placed on the "x".
 *
 */
-static ringslice_cnt_t wa_hex_to_unsigned(ringslice_cnt_t const first,
-                                            ringslice_cnt_t const last,
-                                            uint8_t const buf[],
-                                            ringslice_cnt_t size,
-                                            unsigned long *out) {
-    ringslice_cnt_t cur = wa_skip_spaces(first, last, buf, size);
-    if (last == cur || last == ringslice_index_shift_wrap_around(cur, 1, size)) {
-        return first;
-    }
-    unsigned long value = 0;
+static wa_cursor_t wa_hex_to_unsigned(wa_cursor_t const c, uintmax_t limit, uintmax_t *out) {
+    wa_cursor_t cur = wa_skip_spaces(c);
+    uintmax_t value = 0;
     int isempty = 1;
-    if (buf[cur] == '0' && buf[ringslice_index_shift_wrap_around(cur, 1, size)] == 'x') {
-        cur += 2;
-    }
-    while (cur != last) {
-        if (buf[cur] >= '0' && buf[cur] <= '9') {
-            value = (value * 16) + (buf[cur] - '0');
-        } else if (buf[cur] >= 'a' && buf[cur] <= 'f') {
-            value = (value * 16) + 10 + (buf[cur] - 'a');
-        } else if (buf[cur] >= 'A' && buf[cur] <= 'F') {
-            value = (value * 16) + 10 + (buf[cur] - 'A');
+    wa_cursor_t zero = c;   // cursor after a "0" that precedes the "0x" prefix
+    int prefixed = 0;
+    if (!wa_at_end(cur) && *cur.ptr == '0') {
+        wa_cursor_t prefix = wa_advance(cur);
+        if (!wa_at_end(prefix) && (*prefix.ptr == 'x' || *prefix.ptr == 'X')) {
+            zero = prefix;
+            prefixed = 1;
+            cur = wa_advance(prefix);
+        }
+    }
+    while (!wa_at_end(cur)) {
+        uint8_t chr = *cur.ptr;
+        unsigned int digit;
+        if (chr >= '0' && chr <= '9') {
+            digit = (unsigned int)(chr - '0');
+        } else if (chr >= 'a' && chr <= 'f') {
+            digit = 10U + (unsigned int)(chr - 'a');
+        } else if (chr >= 'A' && chr <= 'F') {
+            digit = 10U + (unsigned int)(chr - 'A');
         } else {
             break;
         }
+        if (value > (UINTMAX_MAX >> 4)) {
+            return c;
+        }
+        value = (value * 16U) + digit;
         isempty = 0;
-        cur = ringslice_index_shift_wrap_around(cur, 1, size);
+        cur = wa_advance(cur);
     }
-    if (isempty) {
-        return first;
+    if (isempty && prefixed) {
+        // like strtoul(): "0x" without hex digits is the number 0 followed by "x"
+        *out = 0;
+        return zero;
+    }
+    if (isempty || value > limit) {
+        return c;
     }
     *out = value;
     return cur;
 }
 
+/// decimal number with at most 19 significant digits: (mantissa + fraction) * 10^exp10, 0 <= fraction < 1
+typedef struct {
+    uint64_t mantissa;      ///< significant digits
+    int32_t exp10;          ///< decimal exponent
+    bool truncated;         ///< there were nonzero digits after the 19th, i.e. fraction > 0
+    bool negative;          ///< there was '-' sign
+    wa_cursor_t digits;     ///< the first digit, to read again all the digits if truncated
+} wa_decimal_t;
+
+/*!
+* Parses decimal floating-point number: [+-]digits[.digits][(e|E)[+-]digits]
+* @param[in] c cursor
+* @param[out] out parsed number
+*
+* @return cursor after the last read and processed char
+    or c on error.
+*
+*/
+static wa_cursor_t wa_parse_decimal(wa_cursor_t const c, wa_decimal_t *out) {
+    wa_cursor_t cur = wa_skip_spaces(c);
+    int digits = 0, significant = 0;
+    int32_t exp10 = 0;
+    out->mantissa = 0;
+    out->truncated = false;
+    out->negative = false;
+    if (!wa_at_end(cur) && (*cur.ptr == '+' || *cur.ptr == '-')) {
+        out->negative = (*cur.ptr == '-');
+        cur = wa_advance(cur);
+    }
+    out->digits = cur;
+    for (int part = 0; part < 2; part++) {
+        while (!wa_at_end(cur) && *cur.ptr >= '0' && *cur.ptr <= '9') {
+            unsigned int digit = (unsigned int)(*cur.ptr - '0');
+            if (significant < 19) {
+                out->mantissa = (out->mantissa * 10U) + digit;
+                significant += (out->mantissa != 0U) ? 1 : 0;
+                exp10 -= part;
+            } else {
+                out->truncated |= (digit != 0U);
+                exp10 += 1 - part;
+            }
+            ++digits;
+            cur = wa_advance(cur);
+        }
+        if (part == 0) {
+            if (wa_at_end(cur) || *cur.ptr != '.') {
+                break;
+            }
+            cur = wa_advance(cur);
+        }
+    }
+    if (digits == 0) {
+        return c;
+    }
+    if (!wa_at_end(cur) && (*cur.ptr == 'e' || *cur.ptr == 'E')) {
+        wa_cursor_t exp = wa_advance(cur);
+        bool expneg = false;
+        int32_t value = 0;
+        if (!wa_at_end(exp) && (*exp.ptr == '+' || *exp.ptr == '-')) {
+            expneg = (*exp.ptr == '-');
+            exp = wa_advance(exp);
+        }
+        if (!wa_at_end(exp) && *exp.ptr >= '0' && *exp.ptr <= '9') {
+            while (!wa_at_end(exp) && *exp.ptr >= '0' && *exp.ptr <= '9') {
+                if (value < 100000) {
+                    value = (value * 10) + (*exp.ptr - '0');
+                }
+                exp = wa_advance(exp);
+            }
+            exp10 += expneg ? -value : value;
+            cur = exp;
+        }
+    }
+    out->exp10 = exp10;
+    return cur;
+}
+
+/*!
+* Converts decimal number to fixed-point value with rounding to nearest
+* @param[in] num decimal number
+* @param[in] frac_bits number of fractional bits of result, up to 31
+* @param[out] out fixed-point value
+*
+* @return true on success, false if value does not fit int32_t
+*
+*/
+static bool decimal_to_fixed(wa_decimal_t const *num, unsigned int frac_bits, int32_t *out) {
+    uint64_t const limit = num->negative ? (1ULL << 31) : ((1ULL << 31) - 1U);
+    uint64_t ip = num->mantissa;
+    uint64_t fp = 0;
+    uint64_t scale = 1;
+    bool sticky = num->truncated;
+    if (num->exp10 > 0) {
+        for (int32_t i = 0; i < num->exp10 && ip != 0U; i++) {
+            if (ip > (limit >> frac_bits)) {
+                return false;
+            }
+            ip *= 10U;
+        }
+    } else if (num->exp10 < 0) {
+        // split mantissa to integer part ip and fraction fp / 10^drop
+        int32_t const drop = -num->exp10;
+        if (drop <= 19) {
+            for (int32_t i = 0; i < drop; i++) {
+                scale *= 10U;
+            }
+            fp = ip % scale;
+            ip /= scale;
+        } else {
+            fp = ip;
+            ip = 0;
+        }
+        // keep 18 decimal digits of fraction so that 2 * fp fits, the rest only matters for rounding
+        int32_t const keep = (drop > 18) ? 18 : drop;
+        for (int32_t i = keep; i < drop && fp != 0U; i++) {
+            sticky |= (fp % 10U) != 0U;
+            fp /= 10U;
+        }
+        scale = 1;
+        for (int32_t i = 0; i < keep; i++) {
+            scale *= 10U;
+        }
+    }
+    if (ip > (limit >> frac_bits)) {
+        return false;
+    }
+    // q = fp * 2^frac_bits / scale bit by bit, fp is the remainder
+    uint64_t q = 0;
+    for (unsigned int i = 0; i < frac_bits; i++) {
+        fp <<= 1;
+        q <<= 1;
+        if (fp >= scale) {
+            fp -= scale;
+            q |= 1U;
+        }
+    }
+    if ((2U * fp > scale) || (2U * fp == scale && (sticky || (q & 1U) != 0U))) {
+        ++q;
+    }
+    uint64_t const total = (ip << frac_bits) + q;
+    if (total > limit) {
+        return false;
+    }
+    *out = num->negative ? (int32_t)(-(int64_t)total) : (int32_t)total;
+    return true;
+}
+
+#if RINGSLICE_CONFIG_SCANF_FLOAT
+
+/// 10^n for n = 0..9
+static uint32_t const pow10_u32[] = {
+    1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U,
+};
+
+/// number of 32-bit words of big integers, enough for 10^362 * 2^56
+#define BIG_WORDS       42
+
+/// big unsigned integer for exact decimal to binary conversion
+typedef struct {
+    uint32_t w[BIG_WORDS];  ///< words, the least significant first
+    int n;                  ///< number of used words
+} big_t;
+
+/*!
+* Initializes big integer
+* @param[out] me big integer
+* @param[in] v initial value
+*
+*/
+static void big_set(big_t *me, uint64_t v) {
+    me->w[0] = (uint32_t)v;
+    me->w[1] = (uint32_t)(v >> 32);
+    me->n = (me->w[1] != 0U) ? 2 : 1;
+}
+
+/*!
+* Multiplies big integer by small one
+* @param[in,out] me big integer
+* @param[in] m multiplier
+*
+*/
+static void big_mul(big_t *me, uint32_t m) {
+    uint64_t carry = 0;
+    for (int i = 0; i < me->n; i++) {
+        uint64_t p = ((uint64_t)me->w[i] * m) + carry;
+        me->w[i] = (uint32_t)p;
+        carry = p >> 32;
+    }
+    if (carry != 0U) {
+        me->w[me->n++] = (uint32_t)carry;
+    }
+}
+
+/*!
+* Multiplies big integer by 10^e
+* @param[in,out] me big integer
+* @param[in] e exponent
+*
+*/
+static void big_mul_pow10(big_t *me, int32_t e) {
+    for (; e >= 9; e -= 9) {
+        big_mul(me, pow10_u32[9]);
+    }
+    big_mul(me, pow10_u32[e]);
+}
+
+/*!
+* Returns number of significant bits of big integer
+* @param[in] me big integer
+*
+* @return number of bits
+*
+*/
+static int big_bitlen(big_t const *me) {
+    int n = me->n;
+    while (n > 0 && me->w[n - 1] == 0U) {
+        --n;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    int bits = 32 * (n - 1);
+    for (uint32_t top = me->w[n - 1]; top != 0U; top >>= 1) {
+        ++bits;
+    }
+    return bits;
+}
+
+/*!
+* Shifts big integer left
+* @param[in,out] me big integer
+* @param[in] s number of bits
+*
+*/
+static void big_shl(big_t *me, int s) {
+    int const words = s / 32;
+    int const bits = s % 32;
+    me->w[me->n] = 0;
+    for (int i = me->n; i >= 0; i--) {
+        uint32_t v = me->w[i] << bits;
+        if (bits != 0 && i > 0) {
+            v |= me->w[i - 1] >> (32 - bits);
+        }
+        me->w[i + words] = v;
+    }
+    for (int i = 0; i < words; i++) {
+        me->w[i] = 0;
+    }
+    me->n += words + 1;
+}
+
+/*!
+* Shifts big integer right by one bit
+* @param[in,out] me big integer
+*
+*/
+static void big_shr1(big_t *me) {
+    for (int i = 0; i < me->n; i++) {
+        me->w[i] = (me->w[i] >> 1) | ((i + 1 < me->n) ? (me->w[i + 1] << 31) : 0U);
+    }
+}
+
+/*!
+* Compares big integers
+* @param[in] a the first big integer
+* @param[in] b the second big integer
+*
+* @return negative if a < b, 0 if a == b, positive if a > b
+*
+*/
+static int big_cmp(big_t const *a, big_t const *b) {
+    int const n = (a->n > b->n) ? a->n : b->n;
+    for (int i = n - 1; i >= 0; i--) {
+        uint32_t x = (i < a->n) ? a->w[i] : 0U;
+        uint32_t y = (i < b->n) ? b->w[i] : 0U;
+        if (x != y) {
+            return (x > y) ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+/*!
+* Subtracts big integers
+* @param[in,out] a minuend, a >= b
+* @param[in] b subtrahend
+*
+*/
+static void big_sub(big_t *a, big_t const *b) {
+    uint64_t borrow = 0;
+    for (int i = 0; i < a->n; i++) {
+        uint64_t d = (uint64_t)a->w[i] - ((i < b->n) ? b->w[i] : 0U) - borrow;
+        a->w[i] = (uint32_t)d;
+        borrow = (d >> 32) & 1U;
+    }
+}
+
+/*!
+* Returns the most significant 64 bits of big integer
+* @param[in] me big integer, not zero
+* @param[out] exp2 binary exponent of the least significant returned bit
+* @param[out] sticky whether dropped bits are not all zero
+*
+* @return 64 bits with the highest one set
+*
+*/
+static uint64_t big_top64(big_t const *me, int32_t *exp2, bool *sticky) {
+    int const len = big_bitlen(me);
+    uint64_t top = 0;
+    *sticky = false;
+    for (int bit = len - 1; bit >= 0; bit--) {
+        uint32_t b = (me->w[bit / 32] >> (bit % 32)) & 1U;
+        if (bit >= len - 64) {
+            top = (top << 1) | b;
+        } else if (b != 0U) {
+            *sticky = true;
+            break;
+        }
+    }
+    if (len < 64) {
+        top <<= (64 - len);
+    }
+    *exp2 = len - 64;
+    return top;
+}
+
+/// format of binary floating-point type
+typedef struct {
+    int prec;               ///< number of significand bits including the implicit one
+    int32_t emin;           ///< exponent of the smallest normal number
+    int32_t emax;           ///< exponent of the largest finite number
+    int32_t min_exp10;      ///< 19 digits with lower decimal exponent round to zero
+    int32_t max_exp10;      ///< any digits with greater decimal exponent round to infinity
+} float_format_t;
+
+/// IEEE 754 binary32
+static float_format_t const binary32 = {24, -126, 127, -66, 40};
+/// IEEE 754 binary64
+static float_format_t const binary64 = {53, -1022, 1023, -362, 310};
+
+/*!
+* Rounds binary number to floating-point format, to nearest with ties to even
+* @param[in] fmt floating-point format
+* @param[in] q significand, value is (q + fraction) * 2^exp2, fraction < 1
+* @param[in] exp2 binary exponent
+* @param[in] sticky whether fraction is not zero
+*
+* @return bits of floating-point number without sign
+*
+*/
+static uint64_t float_round(float_format_t const *fmt, uint64_t q, int32_t exp2, bool sticky) {
+    int len = 0;
+    for (uint64_t t = q; t != 0U; t >>= 1) {
+        ++len;
+    }
+    if (len == 0) {
+        return 0;
+    }
+    int32_t e = exp2 + len - 1;         // exponent of the leading bit
+    int32_t shift = len - fmt->prec;    // number of bits to drop
+    if (e < fmt->emin) {
+        shift += fmt->emin - e;         // subnormal keeps less bits
+    }
+    if (shift > 0) {
+        if (shift > 64) {
+            return 0;
+        }
+        uint64_t const dropped = (shift == 64) ? q : (q & ((1ULL << shift) - 1U));
+        uint64_t const half = 1ULL << (shift - 1);
+        q = (shift == 64) ? 0U : (q >> shift);
+        if (dropped > half || (dropped == half && (sticky || (q & 1U) != 0U))) {
+            ++q;
+        }
+        exp2 += shift;
+    } else {
+        q <<= -shift;
+        exp2 += shift;
+    }
+    if (q >> fmt->prec) {
+        // rounding carried out of the significand
+        q >>= 1;
+        ++exp2;
+    }
+    e = exp2 + fmt->prec - 1;
+    int const frac_bits = fmt->prec - 1;
+    uint64_t const frac_mask = (1ULL << frac_bits) - 1U;
+    if ((q >> frac_bits) == 0U) {
+        return q;                       // subnormal or zero
+    }
+    if (e > fmt->emax) {
+        return (uint64_t)(2 * fmt->emax + 1) << frac_bits;   // infinity
+    }
+    return ((uint64_t)(e + fmt->emax) << frac_bits) | (q & frac_mask);
+}
+
+/*!
+* Converts decimal number with mantissa and exponent in range to floating-point bits
+* @param[in] fmt floating-point format
+* @param[in] num decimal number, the digits dropped from mantissa only set the sticky bit
+*
+* @return bits of floating-point number without sign
+*
+*/
+static uint64_t decimal_to_float_rounded(float_format_t const *fmt, wa_decimal_t const *num) {
+    big_t n;
+    int32_t exp2;
+    bool sticky;
+    big_set(&n, num->mantissa);
+    if (num->exp10 >= 0) {
+        big_mul_pow10(&n, num->exp10);
+        uint64_t q = big_top64(&n, &exp2, &sticky);
+        return float_round(fmt, q, exp2, sticky || num->truncated);
+    }
+    // q = n * 2^s / 10^-exp10 with at least prec + 2 bits
+    big_t d;
+    big_set(&d, 1);
+    big_mul_pow10(&d, -num->exp10);
+    int s = big_bitlen(&d) - big_bitlen(&n) + fmt->prec + 2;
+    if (s < 0) {
+        s = 0;
+    }
+    big_shl(&n, s);
+    int const qbits = big_bitlen(&n) - big_bitlen(&d) + 1;
+    uint64_t q = 0;
+    if (qbits > 0) {
+        big_shl(&d, qbits - 1);
+        for (int i = qbits - 1; i >= 0; i--) {
+            if (big_cmp(&n, &d) >= 0) {
+                big_sub(&n, &d);
+                q |= 1ULL << i;
+            }
+            big_shr1(&d);
+        }
+    }
+    sticky = big_bitlen(&n) != 0 || num->truncated;
+    return float_round(fmt, q, -s, sticky);
+}
+
+/*!
+* Returns the next digit of decimal number
+* @param[in,out] c cursor at the digit or at '.', moved past the returned digit
+* @param[in,out] point whether '.' was already passed
+*
+* @return digit value or -1 if there are no more digits
+*
+*/
+static int wa_next_digit(wa_cursor_t *c, bool *point) {
+    if (!*point && !wa_at_end(*c) && *c->ptr == '.') {
+        *point = true;
+        *c = wa_advance(*c);
+    }
+    if (wa_at_end(*c) || *c->ptr < '0' || *c->ptr > '9') {
+        return -1;
+    }
+    int const digit = *c->ptr - '0';
+    *c = wa_advance(*c);
+    return digit;
+}
+
+/*!
+* Compares all the digits of decimal number with the point halfway between
+* floating-point number and the next one up
+* @param[in] fmt floating-point format
+* @param[in] num decimal number with 19 significant digits in mantissa
+* @param[in] bits bits of floating-point number without sign, not infinity
+*
+* @return negative if num is below the halfway point, 0 if equal, positive if above
+*
+*/
+static int decimal_cmp_halfway(float_format_t const *fmt, wa_decimal_t const *num, uint64_t bits) {
+    int const frac_bits = fmt->prec - 1;
+    int32_t const field = (int32_t)(bits >> frac_bits);
+    uint64_t m = bits & ((1ULL << frac_bits) - 1U);
+    int32_t e = fmt->emin - frac_bits;
+    if (field != 0) {
+        m |= 1ULL << frac_bits;
+        e = field - fmt->emax - frac_bits;
+    }
+    // halfway point is (2m + 1) * 2^(e - 1) = n / d * 10^exp10 with the same
+    // exp10 as the leading digit of num, so that digits of n / d follow the digits of num
+    int32_t const exp10 = num->exp10 + 18;
+    big_t n, d;
+    big_set(&n, (2U * m) + 1U);
+    big_set(&d, 1);
+    if (e - 1 >= 0) {
+        big_shl(&n, e - 1);
+    } else {
+        big_shl(&d, 1 - e);
+    }
+    if (exp10 >= 0) {
+        big_mul_pow10(&d, exp10);
+    } else {
+        big_mul_pow10(&n, -exp10);
+    }
+    wa_cursor_t c = num->digits;
+    bool point = false;
+    int digit;
+    do {
+        digit = wa_next_digit(&c, &point);
+    } while (digit == 0);
+    for (; digit >= 0; digit = wa_next_digit(&c, &point)) {
+        int half = 0;
+        while (half < 10 && big_cmp(&n, &d) >= 0) {
+            big_sub(&n, &d);
+            ++half;
+        }
+        if (half != digit) {
+            return digit - half;
+        }
+        big_mul(&n, 10U);
+    }
+    return (big_bitlen(&n) != 0) ? -1 : 0;
+}
+
 /*!
-* Macro for generation a wrapper function for converter
-* @param FROM_TYPE output type of wrapped function (long, unsigned long)
-* @param TO_TYPE output type of wrapper function (int , unsigned int)
-* @param WRAPPER_NAME name of generated function
-* @param WRAPPED_FUNCTION name of function that is wrapped
+* Converts decimal number to floating-point bits exactly, the slow path
+* @param[in] fmt floating-point format
+* @param[in] num decimal number
+*
+* @return bits of floating-point number without sign
 *
 */
-#define MFMT_WA_TO_TYPE(FROM_TYPE, TO_TYPE, WRAPPER_NAME, WRAPPED_FUNCTION)\
-    static ringslice_cnt_t                            \
-        WRAPPER_NAME(ringslice_cnt_t const first, \
-                         ringslice_cnt_t const last,  \
-                         uint8_t const buf[],         \
-                         ringslice_cnt_t size,        \
-                         TO_TYPE *out) {                 \
-        FROM_TYPE v;                                       \
-        ringslice_cnt_t cur = WRAPPED_FUNCTION(first, \
-                                               last,  \
-                                               buf,   \
-                                               size,  \
-                                               &v);   \
-        if (cur != first) {                           \
-            *out = (TO_TYPE)v;                           \
-        }                                             \
-        return cur;                                   \
+static uint64_t decimal_to_float_exact(float_format_t const *fmt, wa_decimal_t const *num) {
+    uint64_t const inf = (uint64_t)(2 * fmt->emax + 1) << (fmt->prec - 1);
+    if (num->mantissa == 0U || num->exp10 < fmt->min_exp10) {
+        return 0;
+    }
+    if (num->exp10 > fmt->max_exp10) {
+        return inf;
+    }
+    uint64_t bits = decimal_to_float_rounded(fmt, num);
+    if (num->truncated && bits != inf) {
+        // the value lies between mantissa and mantissa + 1 in the last kept digit,
+        // so it rounds to bits or to the next number up: decide with all the digits
+        int const cmp = decimal_cmp_halfway(fmt, num, bits);
+        if (cmp > 0 || (cmp == 0 && (bits & 1U) != 0U)) {
+            ++bits;
+        }
     }
+    return bits;
+}
+
+/// exactly representable powers of ten for the fast path
+static double const pow10_double[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/*!
+* Converts decimal number to double, correctly rounded
+* @param[in] num decimal number
+*
+* @return converted value
+*
+*/
+static double decimal_to_double(wa_decimal_t const *num) {
+    double value;
+    if (!num->truncated && num->mantissa <= (1ULL << 53) && num->exp10 >= -22 && num->exp10 <= 22) {
+        // Clinger's fast path: both operands are exact, so one rounding happens
+        value = (double)num->mantissa;
+        value = (num->exp10 < 0) ? (value / pow10_double[-num->exp10]) : (value * pow10_double[num->exp10]);
+    } else {
+        uint64_t bits = decimal_to_float_exact(&binary64, num);
+        memcpy(&value, &bits, sizeof(value));
+    }
+    return num->negative ? -value : value;
+}
+
+/*!
+* Converts decimal number to float, correctly rounded
+* @param[in] num decimal number
+*
+* @return converted value
+*
+*/
+static float decimal_to_float(wa_decimal_t const *num) {
+    float value;
+    if (!num->truncated && num->mantissa <= (1ULL << 24) && num->exp10 >= -10 && num->exp10 <= 10) {
+        value = (float)num->mantissa;
+        value = (num->exp10 < 0) ? (value / (float)pow10_double[-num->exp10]) : (value * (float)pow10_double[num->exp10]);
+    } else {
+        uint32_t bits = (uint32_t)decimal_to_float_exact(&binary32, num);
+        memcpy(&value, &bits, sizeof(value));
+    }
+    return num->negative ? -value : value;
+}
+
+#endif // RINGSLICE_CONFIG_SCANF_FLOAT
 
 #define MFMT_DEC_TO_UNSIGNED(TYPE, NAME)            \
     static char *                                   \
@@ -310,76 +984,550 @@ static ringslice_cnt_t wa_hex_to_unsigned(ringslice_cnt_t const first,
         return cur;                                 \
     }
 
-MFMT_WA_TO_TYPE(         long,          int,  wa_dec_to_int, wa_dec_to_signed)
-MFMT_WA_TO_TYPE(unsigned long, unsigned int, wa_dec_to_uint, wa_dec_to_unsigned)
-MFMT_WA_TO_TYPE(unsigned long, unsigned int, wa_hex_to_uint, wa_hex_to_unsigned)
-
 MFMT_DEC_TO_UNSIGNED(unsigned int, uint)
 
+/// destination types of signed integer conversion by length modifier
+static uint8_t const signed_types[] = {
+    [RINGSLICE_SCANF_LEN_NONE] = RINGSLICE_SCANF_TYPE_INT,
+    [RINGSLICE_SCANF_LEN_HH] = RINGSLICE_SCANF_TYPE_SCHAR,
+    [RINGSLICE_SCANF_LEN_H] = RINGSLICE_SCANF_TYPE_SHORT,
+    [RINGSLICE_SCANF_LEN_L] = RINGSLICE_SCANF_TYPE_LONG,
+    [RINGSLICE_SCANF_LEN_LL] = RINGSLICE_SCANF_TYPE_LLONG,
+    [RINGSLICE_SCANF_LEN_J] = RINGSLICE_SCANF_TYPE_INTMAX,
+    [RINGSLICE_SCANF_LEN_Z] = RINGSLICE_SCANF_TYPE_PTRDIFF,
+    [RINGSLICE_SCANF_LEN_T] = RINGSLICE_SCANF_TYPE_PTRDIFF,
+};
+
+/// destination types of unsigned integer conversion by length modifier
+static uint8_t const unsigned_types[] = {
+    [RINGSLICE_SCANF_LEN_NONE] = RINGSLICE_SCANF_TYPE_UINT,
+    [RINGSLICE_SCANF_LEN_HH] = RINGSLICE_SCANF_TYPE_UCHAR,
+    [RINGSLICE_SCANF_LEN_H] = RINGSLICE_SCANF_TYPE_USHORT,
+    [RINGSLICE_SCANF_LEN_L] = RINGSLICE_SCANF_TYPE_ULONG,
+    [RINGSLICE_SCANF_LEN_LL] = RINGSLICE_SCANF_TYPE_ULLONG,
+    [RINGSLICE_SCANF_LEN_J] = RINGSLICE_SCANF_TYPE_UINTMAX,
+    [RINGSLICE_SCANF_LEN_Z] = RINGSLICE_SCANF_TYPE_SIZE,
+    [RINGSLICE_SCANF_LEN_T] = RINGSLICE_SCANF_TYPE_SIZE,
+};
+
 /*!
-* Parse argument depending on format
-* @param[in] first index of first byte in ringslice
-* @param[in] last index after last byte in ringslice 
-* @param[in] buf pointer to buffer of ringslice
-* @param[in] size buffer size
-* @param[in] fmt part of format string after 
-*
-* @return an index after the last read and processed char
-    or first on error.
-*
-*/
-static ringslice_cnt_t wa_parse_arg(ringslice_cnt_t const first,
-                                        ringslice_cnt_t const last,
-                                        uint8_t const buf[],
-                                        ringslice_cnt_t size,
-                                        const char * fmt,
-                                        va_list *const args) {
-    int *intp, intv = 0;
-    unsigned int *uintp, uintv = 0, width = 0;
-    char *charp;
-    ringslice_cnt_t cur = first;
-    fmt = dec_to_uint(fmt, &width);
-    if (*fmt == 'd') {
-        cur = wa_dec_to_int(first, last, buf, size, &intv);
-        if (cur != first) {
-            intp = va_arg(*args, int *);
-            *intp = intv;
-        }
-    } else if (*fmt == 'u') {
-        cur = wa_dec_to_uint(first, last, buf, size, &uintv);
-        if (cur != first) {
-            uintp = va_arg(*args, unsigned int *);
-            *uintp = uintv;
-        }
-    } else if (*fmt == 'x' || *fmt == 'X') {
-        cur = wa_hex_to_uint(first, last, buf, size, &uintv);
-        if (cur != first) {
-            uintp = va_arg(*args, unsigned int *);
-            *uintp = uintv;
-        }
-    } else if (*fmt == 'c') {
-        charp = va_arg(*args, char *);
-        if (width == 0) {
-            width = 1;
-        }
-        while (cur != last && uintv < width) {
-            charp[uintv] = buf[cur];
-            cur = ringslice_index_shift_wrap_around(cur, 1, size);
-            ++uintv;
-        }
-    } else if (*fmt == 's') {
-        charp = va_arg(*args, char *);
-        while (cur != last && !is_space(buf[cur]) &&
-               (width == 0 || uintv < width)) {
-            charp[uintv] = buf[cur];
-            cur = ringslice_index_shift_wrap_around(cur, 1, size);
-            ++uintv;
-        }
-        charp[uintv] = '\0';
-    } else if (*fmt == '%' && buf[cur] == '%') {
-        cur = ringslice_index_shift_wrap_around(cur, 1, size);
+* Returns type of destination for instruction
+* @param[in] insn instruction
+*
+* @return type of destination, RINGSLICE_SCANF_TYPE_NONE if instruction does not assign
+*
+*/
+static ringslice_scanf_type_t insn_type(ringslice_scanf_insn_t const *insn) {
+    switch (insn->op) {
+    case RINGSLICE_SCANF_OP_INT:
+        return (ringslice_scanf_type_t)signed_types[insn->len];
+    case RINGSLICE_SCANF_OP_UINT:
+    case RINGSLICE_SCANF_OP_HEX:
+        return (ringslice_scanf_type_t)unsigned_types[insn->len];
+    case RINGSLICE_SCANF_OP_CHARS:
+    case RINGSLICE_SCANF_OP_STRING:
+    case RINGSLICE_SCANF_OP_SCANSET:
+        return RINGSLICE_SCANF_TYPE_CHAR;
+    case RINGSLICE_SCANF_OP_SLICE:
+    case RINGSLICE_SCANF_OP_SLICE_SCANSET:
+        return RINGSLICE_SCANF_TYPE_SLICE;
+    case RINGSLICE_SCANF_OP_FLOAT:
+        return (insn->len == RINGSLICE_SCANF_LEN_L) ? RINGSLICE_SCANF_TYPE_DOUBLE : RINGSLICE_SCANF_TYPE_FLOAT;
+    case RINGSLICE_SCANF_OP_FIXED:
+        return RINGSLICE_SCANF_TYPE_FIXED;
+    default:
+        return RINGSLICE_SCANF_TYPE_NONE;
     }
-    return cur;
+}
+
+/*!
+* Returns range of signed integer destination
+* @param[in] type type of destination
+* @param[out] min minimum value of type
+*
+* @return maximum value of type
+*
+*/
+static intmax_t signed_range(ringslice_scanf_type_t type, intmax_t *min) {
+    switch (type) {
+    case RINGSLICE_SCANF_TYPE_SCHAR:
+        *min = SCHAR_MIN;
+        return SCHAR_MAX;
+    case RINGSLICE_SCANF_TYPE_SHORT:
+        *min = SHRT_MIN;
+        return SHRT_MAX;
+    case RINGSLICE_SCANF_TYPE_LONG:
+        *min = LONG_MIN;
+        return LONG_MAX;
+    case RINGSLICE_SCANF_TYPE_LLONG:
+        *min = LLONG_MIN;
+        return LLONG_MAX;
+    case RINGSLICE_SCANF_TYPE_INTMAX:
+        *min = INTMAX_MIN;
+        return INTMAX_MAX;
+    case RINGSLICE_SCANF_TYPE_PTRDIFF:
+        *min = PTRDIFF_MIN;
+        return PTRDIFF_MAX;
+    default:
+        *min = INT_MIN;
+        return INT_MAX;
+    }
+}
+
+/*!
+* Returns maximum value of unsigned integer destination
+* @param[in] type type of destination
+*
+* @return maximum value of type
+*
+*/
+static uintmax_t unsigned_max(ringslice_scanf_type_t type) {
+    switch (type) {
+    case RINGSLICE_SCANF_TYPE_UCHAR:
+        return UCHAR_MAX;
+    case RINGSLICE_SCANF_TYPE_USHORT:
+        return USHRT_MAX;
+    case RINGSLICE_SCANF_TYPE_ULONG:
+        return ULONG_MAX;
+    case RINGSLICE_SCANF_TYPE_ULLONG:
+        return ULLONG_MAX;
+    case RINGSLICE_SCANF_TYPE_UINTMAX:
+        return UINTMAX_MAX;
+    case RINGSLICE_SCANF_TYPE_SIZE:
+        return SIZE_MAX;
+    default:
+        return UINT_MAX;
+    }
+}
+
+/*!
+* Stores value of signed integer conversion
+* @param[in] arg destination, value fits its type
+* @param[in] value converted value
+*
+*/
+static void store_signed(ringslice_scanf_arg_t const *arg, intmax_t value) {
+    switch (arg->type) {
+    case RINGSLICE_SCANF_TYPE_SCHAR:
+        *arg->to.hh = (signed char)value;
+        break;
+    case RINGSLICE_SCANF_TYPE_SHORT:
+        *arg->to.h = (short)value;
+        break;
+    case RINGSLICE_SCANF_TYPE_LONG:
+        *arg->to.l = (long)value;
+        break;
+    case RINGSLICE_SCANF_TYPE_LLONG:
+        *arg->to.ll = (long long)value;
+        break;
+    case RINGSLICE_SCANF_TYPE_INTMAX:
+        *arg->to.j = value;
+        break;
+    case RINGSLICE_SCANF_TYPE_PTRDIFF:
+        *arg->to.t = (ptrdiff_t)value;
+        break;
+    default:
+        *arg->to.i = (int)value;
+        break;
+    }
+}
+
+/*!
+* Stores value of unsigned integer conversion
+* @param[in] arg destination, value fits its type
+* @param[in] value converted value
+*
+*/
+static void store_unsigned(ringslice_scanf_arg_t const *arg, uintmax_t value) {
+    switch (arg->type) {
+    case RINGSLICE_SCANF_TYPE_UCHAR:
+        *arg->to.uhh = (unsigned char)value;
+        break;
+    case RINGSLICE_SCANF_TYPE_USHORT:
+        *arg->to.uh = (unsigned short)value;
+        break;
+    case RINGSLICE_SCANF_TYPE_ULONG:
+        *arg->to.ul = (unsigned long)value;
+        break;
+    case RINGSLICE_SCANF_TYPE_ULLONG:
+        *arg->to.ull = (unsigned long long)value;
+        break;
+    case RINGSLICE_SCANF_TYPE_UINTMAX:
+        *arg->to.uj = value;
+        break;
+    case RINGSLICE_SCANF_TYPE_SIZE:
+        *arg->to.z = (size_t)value;
+        break;
+    default:
+        *arg->to.u = (unsigned int)value;
+        break;
+    }
+}
+
+/*!
+* Takes destination of conversion from variable arguments
+* @param[out] arg destination with type already set
+* @param[in,out] args arguments
+*
+*/
+static void take_arg(ringslice_scanf_arg_t *arg, va_list *args) {
+    switch (arg->type) {
+    case RINGSLICE_SCANF_TYPE_INT:
+        arg->to.i = va_arg(*args, int *);
+        break;
+    case RINGSLICE_SCANF_TYPE_UINT:
+        arg->to.u = va_arg(*args, unsigned int *);
+        break;
+    case RINGSLICE_SCANF_TYPE_SLICE:
+        arg->to.r = va_arg(*args, ringslice_t *);
+        break;
+    case RINGSLICE_SCANF_TYPE_SCHAR:
+        arg->to.hh = va_arg(*args, signed char *);
+        break;
+    case RINGSLICE_SCANF_TYPE_SHORT:
+        arg->to.h = va_arg(*args, short *);
+        break;
+    case RINGSLICE_SCANF_TYPE_LONG:
+        arg->to.l = va_arg(*args, long *);
+        break;
+    case RINGSLICE_SCANF_TYPE_LLONG:
+        arg->to.ll = va_arg(*args, long long *);
+        break;
+    case RINGSLICE_SCANF_TYPE_INTMAX:
+        arg->to.j = va_arg(*args, intmax_t *);
+        break;
+    case RINGSLICE_SCANF_TYPE_PTRDIFF:
+        arg->to.t = va_arg(*args, ptrdiff_t *);
+        break;
+    case RINGSLICE_SCANF_TYPE_UCHAR:
+        arg->to.uhh = va_arg(*args, unsigned char *);
+        break;
+    case RINGSLICE_SCANF_TYPE_USHORT:
+        arg->to.uh = va_arg(*args, unsigned short *);
+        break;
+    case RINGSLICE_SCANF_TYPE_ULONG:
+        arg->to.ul = va_arg(*args, unsigned long *);
+        break;
+    case RINGSLICE_SCANF_TYPE_ULLONG:
+        arg->to.ull = va_arg(*args, unsigned long long *);
+        break;
+    case RINGSLICE_SCANF_TYPE_UINTMAX:
+        arg->to.uj = va_arg(*args, uintmax_t *);
+        break;
+    case RINGSLICE_SCANF_TYPE_SIZE:
+        arg->to.z = va_arg(*args, size_t *);
+        break;
+    case RINGSLICE_SCANF_TYPE_FLOAT:
+        arg->to.f = va_arg(*args, float *);
+        break;
+    case RINGSLICE_SCANF_TYPE_DOUBLE:
+        arg->to.lf = va_arg(*args, double *);
+        break;
+    case RINGSLICE_SCANF_TYPE_FIXED:
+        arg->to.q = va_arg(*args, int32_t *);
+        break;
+    default:
+        arg->to.c = va_arg(*args, char *);
+        break;
+    }
+}
+
+/*!
+* Parses length modifier of integer conversion
+* @param[in] fmt part of format string after width
+* @param[out] len length modifier
+*
+* @return pointer after length modifier
+*
+*/
+static const char *fmt_length_modifier(const char *fmt, uint8_t *len) {
+    *len = RINGSLICE_SCANF_LEN_NONE;
+    if (fmt[0] == 'h' && fmt[1] == 'h') {
+        *len = RINGSLICE_SCANF_LEN_HH;
+        return fmt + 2;
+    } else if (fmt[0] == 'l' && fmt[1] == 'l') {
+        *len = RINGSLICE_SCANF_LEN_LL;
+        return fmt + 2;
+    } else if (fmt[0] == 'h') {
+        *len = RINGSLICE_SCANF_LEN_H;
+    } else if (fmt[0] == 'l') {
+        *len = RINGSLICE_SCANF_LEN_L;
+    } else if (fmt[0] == 'j') {
+        *len = RINGSLICE_SCANF_LEN_J;
+    } else if (fmt[0] == 'z') {
+        *len = RINGSLICE_SCANF_LEN_Z;
+    } else if (fmt[0] == 't') {
+        *len = RINGSLICE_SCANF_LEN_T;
+    } else {
+        return fmt;
+    }
+    return fmt + 1;
+}
+
+/*!
+* Compiles one directive of format string to instruction
+* @param[in] fmt format string, not empty
+* @param[out] insn compiled instruction
+* @param[out] set storage for set of %[set] conversion, NULL if there is no storage
+*
+* @return pointer after the compiled directive
+    or fmt if conversion is not supported.
+*
+*/
+static const char *fmt_compile_directive(const char *fmt, ringslice_scanf_insn_t *insn, ringslice_charset_t *set) {
+    const char *cur = fmt;
+    unsigned int width = 0;
+    insn->len = RINGSLICE_SCANF_LEN_NONE;
+    insn->width = 0;
+    insn->data.text = NULL;
+    if (is_space(*cur)) {
+        insn->op = RINGSLICE_SCANF_OP_SPACES;
+        return skip_spaces(cur);
+    }
+    if (*cur != '%') {
+        insn->op = RINGSLICE_SCANF_OP_LITERAL;
+        insn->data.text = cur;
+        while (*cur != '\0' && *cur != '%' && !is_space(*cur) && insn->width < UINT16_MAX) {
+            ++insn->width;
+            ++cur;
+        }
+        return cur;
+    }
+    ++cur;
+    if (*cur == '%') {
+        insn->op = RINGSLICE_SCANF_OP_LITERAL;
+        insn->data.text = cur;
+        insn->width = 1;
+        return cur + 1;
+    }
+    cur = dec_to_uint(cur, &width);
+    if (width > UINT16_MAX) {
+        return fmt;
+    }
+    insn->width = (uint16_t)width;
+    cur = fmt_length_modifier(cur, &insn->len);
+    if (*cur == 'f' || *cur == 'F' || *cur == 'e' || *cur == 'E' || *cur == 'g' || *cur == 'G') {
+        if (!RINGSLICE_CONFIG_SCANF_FLOAT || (insn->len != RINGSLICE_SCANF_LEN_NONE && insn->len != RINGSLICE_SCANF_LEN_L)) {
+            return fmt;
+        }
+        insn->op = RINGSLICE_SCANF_OP_FLOAT;
+        return cur + 1;
+    }
+    if (insn->len != RINGSLICE_SCANF_LEN_NONE && *cur != 'd' && *cur != 'u' && *cur != 'x' && *cur != 'X') {
+        return fmt;
+    }
+    if (*cur == 'q') {
+        unsigned int frac_bits = 0;
+        const char *bits = dec_to_uint(cur + 1, &frac_bits);
+        if (bits == cur + 1 || frac_bits > 31) {
+            return fmt;
+        }
+        insn->op = RINGSLICE_SCANF_OP_FIXED;
+        insn->len = (uint8_t)frac_bits;
+        return bits;
+    }
+    bool slice = false;
+    if (*cur == 'r') {
+        ++cur;
+        if (*cur != '[') {
+            insn->op = RINGSLICE_SCANF_OP_SLICE;
+            return cur;
+        }
+        slice = true;
+    }
+    if (*cur == 'd') {
+        insn->op = RINGSLICE_SCANF_OP_INT;
+    } else if (*cur == 'u') {
+        insn->op = RINGSLICE_SCANF_OP_UINT;
+    } else if (*cur == 'x' || *cur == 'X') {
+        insn->op = RINGSLICE_SCANF_OP_HEX;
+    } else if (*cur == 'c') {
+        insn->op = RINGSLICE_SCANF_OP_CHARS;
+    } else if (*cur == 's') {
+        insn->op = RINGSLICE_SCANF_OP_STRING;
+    } else if (*cur == '[' && set != NULL) {
+        ++cur;
+        cur = &cur[ringslice_charset_compile(set, cur)];
+        if (*cur != ']') {
+            return fmt;
+        }
+        insn->op = slice ? RINGSLICE_SCANF_OP_SLICE_SCANSET : RINGSLICE_SCANF_OP_SCANSET;
+        insn->data.set = set;
+    } else {
+        return fmt;
+    }
+    return cur + 1;
+}
+
+/*!
+* Scans token of string-like conversion
+* @param[in] c cursor
+* @param[in] set accepted bytes, NULL if token is terminated by whitespace
+* @param[in] width maximum length of token, 0 if not limited
+* @param[out] dst destination for null-terminated copy of token, NULL if token is not copied
+*
+* @return cursor after the last byte of token
+*
+*/
+static inline wa_cursor_t wa_scan_token(wa_cursor_t c, ringslice_charset_t const *set, unsigned int width, char *dst) {
+    unsigned int i = 0;
+    while (!wa_at_end(c) && (width == 0 || i < width) &&
+           ((set != NULL) ? ringslice_charset_contains(set, *c.ptr) : !is_space((char)*c.ptr))) {
+        if (dst != NULL) {
+            dst[i] = (char)*c.ptr;
+        }
+        c = wa_advance(c);
+        ++i;
+    }
+    if (dst != NULL) {
+        dst[i] = '\0';
+    }
+    return c;
+}
+
+/*!
+* Returns position of cursor relative to the beginning of ringslice
+* @param[in] rs ringslice instance the cursor walks
+* @param[in] c cursor
+*
+* @return relative index of the byte under cursor, length of ringslice at the end
+*
+*/
+static ringslice_cnt_t wa_offset(ringslice_t const *const rs, wa_cursor_t c) {
+    if (wa_at_end(c)) {
+        return ringslice_len(rs);  // end of slice of the whole buffer is at its first byte
+    }
+    ringslice_cnt_t const idx = ringslice_wrap((ringslice_cnt_t)(c.ptr - rs->buf), rs->buf_size);
+    return ringslice_wrap(rs->buf_size + idx - rs->first, rs->buf_size);
+}
+
+/*!
+* Checks whether instruction converts number, so width limits the number of its digits
+* @param[in] op instruction
+*
+* @return true for integer, floating-point and fixed-point conversions, otherwise false
+*
+*/
+static bool is_numeric_op(uint8_t op) {
+    return (op == RINGSLICE_SCANF_OP_INT || op == RINGSLICE_SCANF_OP_UINT || op == RINGSLICE_SCANF_OP_HEX ||
+            op == RINGSLICE_SCANF_OP_FIXED || op == RINGSLICE_SCANF_OP_FLOAT);
+}
+
+/*!
+* Executes instruction that consumes bytes
+* @param[in] rs ringslice instance the cursor walks
+* @param[in,out] me cursor, not at the end; moved after the last processed char on success
+* @param[in] insn instruction, not RINGSLICE_SCANF_OP_END
+* @param[in] arg destination of conversion with type matching the instruction,
+*   not used by literals and whitespaces
+*
+* @return true on success, false on error (cursor is not moved)
+*
+*/
+static bool wa_exec_insn(ringslice_t const *const rs,
+                         wa_cursor_t *const me,
+                         ringslice_scanf_insn_t const *insn,
+                         ringslice_scanf_arg_t const *arg) {
+    wa_cursor_t const c = *me;
+    wa_cursor_t cur = c;
+    wa_cursor_t start = c;  // first char of number, whitespaces are skipped if its width is limited
+    wa_cursor_t num = c;    // input of numeric conversion, limited to width
+    bool const limited = (insn->width != 0) && is_numeric_op(insn->op);
+    unsigned int i = 0;
+    if (limited) {
+        start = wa_skip_spaces(c);
+        num = wa_limit(start, insn->width);
+    }
+    switch (insn->op) {
+    case RINGSLICE_SCANF_OP_LITERAL:
+        for (; i < insn->width; i++) {
+            if (wa_at_end(cur) || *cur.ptr != (uint8_t)insn->data.text[i]) {
+                return false;
+            }
+            cur = wa_advance(cur);
+        }
+        break;
+    case RINGSLICE_SCANF_OP_SPACES:
+        cur = wa_skip_spaces(cur);
+        break;
+    case RINGSLICE_SCANF_OP_INT: {
+        intmax_t min, value = 0;
+        intmax_t const max = signed_range(arg->type, &min);
+        cur = wa_dec_to_signed(num, min, max, &value);
+        if (cur.ptr == num.ptr) {
+            return false;
+        }
+        store_signed(arg, value);
+        break;
+    }
+    case RINGSLICE_SCANF_OP_UINT:
+    case RINGSLICE_SCANF_OP_HEX: {
+        uintmax_t value = 0;
+        uintmax_t const max = unsigned_max(arg->type);
+        cur = (insn->op == RINGSLICE_SCANF_OP_UINT) ? wa_dec_to_unsigned(num, max, &value) :
+                                                      wa_hex_to_unsigned(num, max, &value);
+        if (cur.ptr == num.ptr) {
+            return false;
+        }
+        store_unsigned(arg, value);
+        break;
+    }
+    case RINGSLICE_SCANF_OP_FIXED: {
+        wa_decimal_t dec;
+        int32_t value;
+        cur = wa_parse_decimal(num, &dec);
+        if (cur.ptr == num.ptr || !decimal_to_fixed(&dec, insn->len, &value)) {
+            return false;
+        }
+        *arg->to.q = value;
+        break;
+    }
+#if RINGSLICE_CONFIG_SCANF_FLOAT
+    case RINGSLICE_SCANF_OP_FLOAT: {
+        wa_decimal_t dec;
+        cur = wa_parse_decimal(num, &dec);
+        if (cur.ptr == num.ptr) {
+            return false;
+        }
+        if (arg->type == RINGSLICE_SCANF_TYPE_DOUBLE) {
+            *arg->to.lf = decimal_to_double(&dec);
+        } else {
+            *arg->to.f = decimal_to_float(&dec);
+        }
+        break;
+    }
+#endif
+    case RINGSLICE_SCANF_OP_CHARS:
+        while (!wa_at_end(cur) && (i < insn->width || i == 0)) {
+            arg->to.c[i] = (char)*cur.ptr;
+            cur = wa_advance(cur);
+            ++i;
+        }
+        break;
+    case RINGSLICE_SCANF_OP_STRING:
+        cur = wa_scan_token(c, NULL, insn->width, arg->to.c);
+        break;
+    case RINGSLICE_SCANF_OP_SCANSET:
+        cur = wa_scan_token(c, insn->data.set, insn->width, arg->to.c);
+        break;
+    case RINGSLICE_SCANF_OP_SLICE:
+    case RINGSLICE_SCANF_OP_SLICE_SCANSET:
+        cur = wa_scan_token(c, insn->data.set, insn->width, NULL);
+        if (cur.ptr != c.ptr) {
+            *arg->to.r = ringslice_rel_slice(rs, wa_offset(rs, c), wa_offset(rs, cur));
+        }
+        break;
+    default:
+        break;
+    }
+    if (cur.ptr == c.ptr && insn->op != RINGSLICE_SCANF_OP_SPACES) {
+        return false;
+    }
+    if (limited) {
+        cur = wa_unlimit(start, num, cur);
+    }
+    *me = cur;
+    return true;
 }
 
 /*
@@ -388,43 +1536,131 @@ static ringslice_cnt_t wa_parse_arg(ringslice_cnt_t const first,
 
 int ringslice_scanf(ringslice_t const * const rs, const char * fmt, ...) {
     DBC_REQUIRE(444, rs);
-    ringslice_cnt_t const first = rs->first;
-    ringslice_cnt_t const last = rs->last;
-    ringslice_cnt_t const size = rs->buf_size;
-    uint8_t const *const buf = rs->buf;
-
-    ringslice_cnt_t cur = first;
+    wa_cursor_t cur = wa_cursor_init(rs);
 
     int ret = 0;
     va_list args;
     va_start(args, fmt);
 
-    while (fmt[0] != '\0' && cur != last) {
-        if (fmt[0] == '%') {
-            ringslice_cnt_t tmp = wa_parse_arg(cur, last, buf, size, &fmt[1], &args);
-            if (tmp == cur) {
+    while (fmt[0] != '\0' && !wa_at_end(cur)) {
+        if (fmt[0] == '%' && fmt[1] != '%') {
+            ringslice_scanf_insn_t insn;
+            ringslice_scanf_arg_t arg;
+            ringslice_charset_t set;
+            const char *next = fmt_compile_directive(fmt, &insn, &set);
+            if (next == fmt) {
                 break;
             }
-            if (fmt[1] != '%') {
-                ++ret;
+            fmt = next;
+            arg.type = insn_type(&insn);
+            take_arg(&arg, &args);
+            if (!wa_exec_insn(rs, &cur, &insn, &arg)) {
+                break;
             }
+            ++ret;
+        } else if (is_space(fmt[0])) {
             ++fmt;
-            while (fmt[0] >= '0' && fmt[0] <= '9') {
+            cur = wa_skip_spaces(cur);
+        } else {
+            if (fmt[0] == '%') {
                 ++fmt;
             }
+            if (fmt[0] != (char)*cur.ptr) {
+                break;
+            }
             ++fmt;
-            cur = tmp;
-        } else if (is_space(fmt[0])) {
-            ++fmt;
-            cur = wa_skip_spaces(cur, last, buf, size);
-        } else if (fmt[0] == buf[cur]) {
-            ++fmt;
-            cur = ringslice_index_shift_wrap_around(cur, 1, size);
-        } else {
-            break;
+            cur = wa_advance(cur);
         }
     }
 
     va_end(args);
     return ret;
 }
+
+ringslice_cnt_t ringslice_charset_compile(ringslice_charset_t * const me, const char *scanset) {
+    DBC_REQUIRE(450, me);
+    DBC_REQUIRE(451, scanset);
+    uint8_t const *cur = (uint8_t const *)scanset;
+    bool const negate = (*cur == '^');
+    if (negate) {
+        ++cur;
+    }
+    memset(me->bits, 0, sizeof(me->bits));
+    uint8_t const *const members = cur;
+    while (*cur != '\0' && (*cur != ']' || cur == members)) {
+        uint8_t lo = *cur;
+        uint8_t hi = lo;
+        if (cur[1] == '-' && cur[2] != '\0' && cur[2] != ']' && cur[2] >= lo) {
+            hi = cur[2];
+            cur += 2;
+        }
+        for (unsigned int b = lo; b <= hi; b++) {
+            me->bits[b >> 3] |= (uint8_t)(1u << (b & 7u));
+        }
+        ++cur;
+    }
+    if (negate) {
+        for (size_t i = 0; i < sizeof(me->bits); i++) {
+            me->bits[i] = (uint8_t)~me->bits[i];
+        }
+    }
+    return (ringslice_cnt_t)(cur - (uint8_t const *)scanset);
+}
+
+ringslice_cnt_t ringslice_scanf_compile(ringslice_scanf_insn_t prog[], ringslice_cnt_t capacity,
+                                        ringslice_charset_t sets[], ringslice_cnt_t set_capacity, const char *fmt) {
+    DBC_REQUIRE(445, prog);
+    DBC_REQUIRE(446, fmt);
+    ringslice_cnt_t cnt = 0;
+    ringslice_cnt_t set_cnt = 0;
+    while (fmt[0] != '\0') {
+        if (cnt + 1 >= capacity) {
+            return -1;
+        }
+        const char *next = fmt_compile_directive(fmt, &prog[cnt], (set_cnt < set_capacity) ? &sets[set_cnt] : NULL);
+        if (next == fmt) {
+            return -1;
+        }
+        if (prog[cnt].op == RINGSLICE_SCANF_OP_SCANSET || prog[cnt].op == RINGSLICE_SCANF_OP_SLICE_SCANSET) {
+            ++set_cnt;
+        }
+        fmt = next;
+        ++cnt;
+    }
+    if (cnt >= capacity) {
+        return -1;
+    }
+    prog[cnt].op = RINGSLICE_SCANF_OP_END;
+    prog[cnt].len = RINGSLICE_SCANF_LEN_NONE;
+    prog[cnt].width = 0;
+    prog[cnt].data.text = NULL;
+    return cnt + 1;
+}
+
+int ringslice_scanf_exec(ringslice_t const * const rs, ringslice_scanf_insn_t const prog[],
+                         ringslice_scanf_arg_t const args[], int arg_cnt) {
+    DBC_REQUIRE(447, rs);
+    DBC_REQUIRE(448, prog);
+    wa_cursor_t cur = wa_cursor_init(rs);
+    int ret = 0;
+
+    for (ringslice_scanf_insn_t const *insn = prog; insn->op != RINGSLICE_SCANF_OP_END && !wa_at_end(cur); insn++) {
+        DBC_REQUIRE(452, insn->len <= RINGSLICE_SCANF_LEN_T || insn->op == RINGSLICE_SCANF_OP_FIXED);
+        ringslice_scanf_type_t const type = insn_type(insn);
+        ringslice_scanf_arg_t const *arg = NULL;
+        if (type != RINGSLICE_SCANF_TYPE_NONE) {
+            DBC_REQUIRE(449, ret < arg_cnt && args[ret].type == type);
+            if (ret >= arg_cnt || args[ret].type != type) {
+                break;
+            }
+            arg = &args[ret];
+        }
+        if (!wa_exec_insn(rs, &cur, insn, arg)) {
+            break;
+        }
+        if (arg != NULL) {
+            ++ret;
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,58 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Nikita Maltsev (aleph-five)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/*! @file
+* @brief Lock-free single-producer single-consumer ring buffer.
+*
+*/
+#include <string.h>
+#include "ringslice_util.h"
+#include "ringslice_spsc.h"
+
+DBC_MODULE_NAME(RINGSLICE_MODULE)
+
+/*
+ * Public functions.
+ */
+
+ringslice_cnt_t ringslice_spsc_push_bulk(ringslice_spsc_t *const me, uint8_t const *src, ringslice_cnt_t n) {
+    DBC_REQUIRE(800, src || n == 0);
+    DBC_REQUIRE(801, 0 <= n);
+    ringslice_seq_t const head = atomic_load_explicit(&me->head, memory_order_relaxed);
+    ringslice_seq_t const tail = atomic_load_explicit(&me->tail, memory_order_acquire);
+    ringslice_cnt_t const free_cnt = me->buf_size - (ringslice_cnt_t)(head - tail);
+    if (n > free_cnt) {
+        n = free_cnt;
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    ringslice_cnt_t const head_idx = me->head_idx;
+    ringslice_cnt_t const chunk = (n < me->buf_size - head_idx) ? n : (me->buf_size - head_idx);
+    memcpy(&(me->buf[head_idx]), src, (size_t)chunk);
+    memcpy(&(me->buf[0]), &(src[chunk]), (size_t)(n - chunk));
+    me->head_idx = ringslice_wrap(head_idx + n, me->buf_size);
+    atomic_store_explicit(&me->head, head + (ringslice_seq_t)n, memory_order_release);
+    return n;
+}
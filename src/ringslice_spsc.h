@@ -0,0 +1,175 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Nikita Maltsev (aleph-five)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _RINGSLICE_SPSC_H_
+#define _RINGSLICE_SPSC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*! @file
+* @brief Lock-free single-producer single-consumer ring buffer producing ringslices
+*
+* @note
+* Requires C11 atomics (<stdatomic.h>). Producer may be an ISR or a thread,
+* consumer may be the main loop or another thread; no locks are taken.
+*/
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "dbc_assert.h"
+#include "ringslice_config.h"
+#include "ringslice.h"
+
+/**
+* @defgroup RingsliceSpsc Ringslice SPSC Ring Buffer
+* @{
+*/
+
+/// single-producer single-consumer ring buffer
+typedef struct
+{
+    uint8_t *buf;                       ///< Pointer to zeroth element of ring buffer array
+    ringslice_cnt_t buf_size;           ///< size of array, ring holds up to buf_size bytes
+    _Atomic ringslice_seq_t head;       ///< free-running number of pushed bytes, written by producer only
+    _Atomic ringslice_seq_t tail;       ///< free-running number of released bytes, written by consumer only
+    ringslice_cnt_t head_idx;           ///< index of head in buffer, private to producer
+    ringslice_cnt_t tail_idx;           ///< index of tail in buffer, private to consumer
+}
+ringslice_spsc_t;
+
+/*!
+* Initializes empty ring buffer
+* @param[out] me ring buffer instance
+* @param[in] buf pointer to zeroth element of ring buffer
+* @param[in] buf_size size of buffer (power of two if RINGSLICE_CONFIG_POW2 is enabled)
+*
+* @note must be called before producer and consumer are started
+*
+*/
+RINGSLICE_INLINE void ringslice_spsc_init(ringslice_spsc_t * const me, uint8_t *buf, ringslice_cnt_t buf_size) {
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 14, buf);
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 15, buf_size > 1);
+#if RINGSLICE_CONFIG_POW2
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 17, (buf_size & (buf_size - 1)) == 0);
+#endif
+    me->buf = buf;
+    me->buf_size = buf_size;
+    atomic_init(&me->head, 0);
+    atomic_init(&me->tail, 0);
+    me->head_idx = 0;
+    me->tail_idx = 0;
+}
+
+/*!
+* Pushes byte into ring buffer, producer side
+* @param[in,out] me ring buffer instance
+* @param[in] byte pushed byte
+*
+* @return true if byte is pushed, false if ring buffer is full
+*
+* @note byte is written before head is published with release ordering,
+*   so consumer that sees new head sees the byte as well
+*
+*/
+RINGSLICE_INLINE bool ringslice_spsc_push(ringslice_spsc_t * const me, uint8_t byte) {
+    ringslice_seq_t const head = atomic_load_explicit(&me->head, memory_order_relaxed);
+    if (head - atomic_load_explicit(&me->tail, memory_order_acquire) == (ringslice_seq_t)me->buf_size) {
+        return false;
+    }
+    me->buf[me->head_idx] = byte;
+    me->head_idx = ringslice_wrap(me->head_idx + 1, me->buf_size);
+    atomic_store_explicit(&me->head, head + 1, memory_order_release);
+    return true;
+}
+
+/*!
+* Pushes bytes into ring buffer, producer side
+* @param[in,out] me ring buffer instance
+* @param[in] src pushed bytes
+* @param[in] n number of bytes in src
+*
+* @return number of pushed bytes, which is less than n if ring buffer becomes full
+*
+* @note bytes are copied with at most two memcpy() calls and published at once
+*
+*/
+ringslice_cnt_t ringslice_spsc_push_bulk(ringslice_spsc_t * const me, uint8_t const *src, ringslice_cnt_t n);
+
+/*!
+* Number of bytes available for reading, consumer side
+* @param[in] me ring buffer instance
+*
+* @return number of bytes pushed and not released yet, up to buf_size
+*
+* @note difference of free-running counters is correct when they wrap around at 2^32
+*
+*/
+RINGSLICE_INLINE ringslice_cnt_t ringslice_spsc_len(ringslice_spsc_t * const me) {
+    return (ringslice_cnt_t)(atomic_load_explicit(&me->head, memory_order_acquire) -
+                             atomic_load_explicit(&me->tail, memory_order_relaxed));
+}
+
+/*!
+* Takes snapshot of bytes available for reading, consumer side
+* @param[in] me ring buffer instance
+*
+* @return ringslice with bytes pushed so far and not released yet, up to the whole buffer;
+*   producer does not overwrite them until they are released
+*
+*/
+RINGSLICE_INLINE ringslice_t ringslice_spsc_acquire_readable(ringslice_spsc_t * const me) {
+    ringslice_t rs = ringslice_len_initializer(me->buf, me->buf_size, me->tail_idx, ringslice_spsc_len(me));
+#if RINGSLICE_CONFIG_SEQ
+    rs.seq = atomic_load_explicit(&me->tail, memory_order_relaxed);
+#endif
+    return rs;
+}
+
+/*!
+* Releases bytes at the beginning of readable ringslice, consumer side
+* @param[in,out] me ring buffer instance
+* @param[in] n number of released bytes, must not exceed ringslice_spsc_len()
+*
+* @note released bytes may be overwritten by producer afterwards,
+*   so subslices referencing them must not be used any more
+*
+*/
+RINGSLICE_INLINE void ringslice_spsc_release(ringslice_spsc_t * const me, ringslice_cnt_t n) {
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 16, 0 <= n && n <= ringslice_spsc_len(me));
+    ringslice_seq_t const tail = atomic_load_explicit(&me->tail, memory_order_relaxed);
+    me->tail_idx = ringslice_wrap(me->tail_idx + n, me->buf_size);
+    atomic_store_explicit(&me->tail, tail + (ringslice_seq_t)n, memory_order_release);
+}
+
+/*!
+* @}
+*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _RINGSLICE_SPSC_H_
@@ -0,0 +1,100 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Nikita Maltsev (aleph-five)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/*! @file
+* @brief Splitting ringslices into tokens.
+*
+*/
+#include "ringslice_util.h"
+#include "ringslice.h"
+
+DBC_MODULE_NAME(RINGSLICE_MODULE)
+
+/*
+ * Private functions.
+ */
+
+/*!
+* Finds delimiter ending the current token, skipping quoted parts
+* @param[in] me tokenizer instance
+*
+* @return relative index of delimiter in rest of slice, length of rest if there is none
+*
+*/
+static ringslice_cnt_t token_end(ringslice_tokenizer_t const *const me) {
+    ringslice_view_t const view = ringslice_split(&me->rest);
+    ringslice_cnt_t pos = 0;
+    bool quoted = false;
+
+    for (int s = 0; s < 2; s++) {
+        for (ringslice_cnt_t i = 0; i < view.seg_len[s]; i++, pos++) {
+            uint8_t const byte = view.seg[s][i];
+            if (me->quote != 0 && byte == me->quote) {
+                quoted = !quoted;
+            } else if (!quoted && ((me->delims != NULL) ? ringslice_charset_contains(me->delims, byte) : (byte == me->delim))) {
+                return pos;
+            }
+        }
+    }
+    return pos;
+}
+
+/*
+ * Public functions.
+ */
+
+bool ringslice_tokenizer_next(ringslice_tokenizer_t *const me, ringslice_t *const token) {
+    DBC_REQUIRE(600, me);
+    DBC_REQUIRE(601, token);
+    if (me->done) {
+        return false;
+    }
+
+    ringslice_cnt_t const len = ringslice_len(&me->rest);
+    ringslice_cnt_t end;
+    if (me->delims == NULL && me->quote == 0) {
+        end = ringslice_memchr(&me->rest, me->delim);
+        if (end < 0) {
+            end = len;
+        }
+    } else {
+        end = token_end(me);
+    }
+
+    ringslice_cnt_t from = 0;
+    ringslice_cnt_t to = end;
+    if (me->quote != 0 && end >= 2 &&
+        ringslice_nth_byte(&me->rest, 0) == me->quote && ringslice_nth_byte(&me->rest, end - 1) == me->quote) {
+        from = 1;
+        to = end - 1;
+    }
+    *token = ringslice_rel_slice(&me->rest, from, to);
+
+    if (end < len) {
+        me->rest = ringslice_rel_slice(&me->rest, end + 1, len);
+    } else {
+        me->rest = ringslice_rel_slice(&me->rest, len, len);
+        me->done = true;
+    }
+    return true;
+}
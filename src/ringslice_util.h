@@ -43,6 +43,48 @@ extern "C" {
  * @{
  */
 
+/// ringslice viewed as at most two contiguous segments of the ring buffer
+typedef struct {
+    uint8_t const *seg[2];        ///< pointers to the first byte of each segment
+    ringslice_cnt_t seg_len[2];   ///< lengths of segments; second one is 0 if ringslice does not wrap around
+} ringslice_view_t;
+
+/*!
+ * Splits ringslice into contiguous segments of the ring buffer
+ * @param[in] me ringslice instance
+ *
+ * @return view of ringslice as two segments
+ */
+RINGSLICE_INLINE ringslice_view_t ringslice_split(ringslice_t const *const me) {
+    ringslice_span_t spans[2];
+    ringslice_view_t view;
+    (void)ringslice_spans(me, spans);
+    for (int i = 0; i < 2; i++) {
+        view.seg[i] = spans[i].ptr;
+        view.seg_len[i] = spans[i].len;
+    }
+    return view;
+}
+
+/*!
+ * Subslice that may be empty at any position, including the end of slice
+ * @param[in] me ringslice instance
+ * @param[in] rel_first relative index of the first byte
+ * @param[in] rel_last relative index after the last byte
+ *
+ * @return subslice of me, with sequence number if RINGSLICE_CONFIG_SEQ is enabled
+ */
+RINGSLICE_INLINE ringslice_t ringslice_rel_slice(ringslice_t const *const me, ringslice_cnt_t rel_first, ringslice_cnt_t rel_last) {
+    ringslice_t rs = ringslice_initializer(me->buf, me->buf_size,
+                                           ringslice_wrap(me->first + rel_first, me->buf_size),
+                                           ringslice_wrap(me->first + rel_last, me->buf_size));
+    rs.full = (rel_last - rel_first == me->buf_size);
+#if RINGSLICE_CONFIG_SEQ
+    rs.seq = me->seq + (ringslice_seq_t)rel_first;
+#endif
+    return rs;
+}
+
  /*!
  * Increments pointer with wrapping around
  * @param[in] curr pointer to increment
@@ -80,7 +122,7 @@ RINGSLICE_INLINE uint8_t *ringslice_ptr_decrement_wrap_around(uint8_t const *cur
 /*!
  * Shifts index (forward or backward) with wrapping around
  * @param[in] idx index to increment
- * @param[in] inc increment value (positive or negative)
+ * @param[in] inc increment value (positive or negative), absolute value must not exceed mod
  * @param[in] mod module to wrap around
  *
  * @return new index between 0 and mod - 1
@@ -89,7 +131,8 @@ RINGSLICE_INLINE uint8_t *ringslice_ptr_decrement_wrap_around(uint8_t const *cur
 RINGSLICE_INLINE ringslice_cnt_t ringslice_index_shift_wrap_around(ringslice_cnt_t idx, ringslice_cnt_t inc, ringslice_cnt_t mod) {
     DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 11, 0 <= idx && idx < mod);
     DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 12, mod + inc > 0);
-    return (idx + mod + inc) % mod;
+    DBC_MODULE_REQUIRE(RINGSLICE_MODULE, 13, inc <= mod);
+    return ringslice_wrap((inc < 0) ? (idx + mod + inc) : (idx + inc), mod);
 }
 
 /*!
@@ -9,6 +9,32 @@ extern "C" {
 
 #define RINGSLICE_INLINE                    static inline
 
+/// set to 1 if sizes of all ring buffers are powers of two, so that indexes are wrapped by bit masking
+#ifndef RINGSLICE_CONFIG_POW2
+#define RINGSLICE_CONFIG_POW2               0
+#endif
+
+/// set to 1 to use portable word-at-a-time byte search instead of SIMD kernels (SSE2/AVX2/NEON)
+#define RINGSLICE_CONFIG_NO_SIMD            0
+
+/// set to 0 to drop %f/%e/%g conversions of ringslice_scanf() (and soft-float code on FPU-less targets)
+#define RINGSLICE_CONFIG_SCANF_FLOAT        1
+
+/// set to 1 to enable ringslice_iovec() (requires POSIX <sys/uio.h>)
+#ifndef RINGSLICE_CONFIG_IOVEC
+#define RINGSLICE_CONFIG_IOVEC              1
+#endif
+
+/// set to 1 to record sequence numbers in ringslices, so that stale slices are detected by ringslice_is_valid()
+#ifndef RINGSLICE_CONFIG_SEQ
+#define RINGSLICE_CONFIG_SEQ                1
+#endif
+
+/// set to 1 to enable ringslice_mirror_t, ring buffer mapped twice in a row (requires Linux memfd_create())
+#ifndef RINGSLICE_CONFIG_MIRROR
+#define RINGSLICE_CONFIG_MIRROR             1
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,43 @@
+//============================================================================
+// Multi-pattern search automaton for AT responses, generated on host by tools/ringslice_gen
+//============================================================================
+#ifndef MULTI_TABLE_H_
+#define MULTI_TABLE_H_
+
+#include "ringslice.h"
+
+// generated by ringslice_gen from 6 patterns
+static ringslice_multi_node_t const at_responses_nodes[29] = {
+    {19, 0, 0, 0, 0, -1, 0x00},
+    {2, 0, 0, 0, 1, -1, 0x4F},
+    {0, 0, 0, 0, 2, 0, 0x4B},
+    {4, 1, 0, 0, 1, -1, 0x45},
+    {5, 0, 19, 0, 2, -1, 0x52},
+    {6, 0, 19, 0, 3, -1, 0x52},
+    {7, 0, 1, 0, 4, -1, 0x4F},
+    {0, 0, 19, 0, 5, 1, 0x52},
+    {9, 3, 0, 0, 1, -1, 0x2B},
+    {10, 0, 0, 0, 2, -1, 0x43},
+    {23, 0, 0, 0, 3, -1, 0x4D},
+    {12, 0, 3, 0, 4, -1, 0x45},
+    {13, 0, 0, 0, 5, -1, 0x20},
+    {14, 0, 3, 0, 6, -1, 0x45},
+    {15, 0, 4, 0, 7, -1, 0x52},
+    {16, 0, 5, 0, 8, -1, 0x52},
+    {17, 0, 6, 0, 9, -1, 0x4F},
+    {18, 0, 7, 7, 10, -1, 0x52},
+    {0, 0, 0, 0, 11, 2, 0x3A},
+    {20, 8, 0, 0, 1, -1, 0x52},
+    {21, 0, 0, 0, 2, -1, 0x49},
+    {22, 0, 0, 0, 3, -1, 0x4E},
+    {26, 0, 0, 0, 4, 3, 0x47},
+    {24, 11, 0, 0, 4, -1, 0x54},
+    {25, 0, 0, 0, 5, -1, 0x49},
+    {0, 0, 0, 0, 6, 4, 0x3A},
+    {27, 0, 0, 0, 5, -1, 0x49},
+    {28, 0, 0, 0, 6, -1, 0x4E},
+    {0, 0, 0, 0, 7, 5, 0x47},
+};
+static ringslice_multi_t const at_responses = {at_responses_nodes, 29, 11};
+
+#endif // MULTI_TABLE_H_
@@ -0,0 +1,30 @@
+//============================================================================
+// Precompiled scanf program for SMS header, generated on host by tools/ringslice_gen
+//============================================================================
+#ifndef SCANF_TABLE_H_
+#define SCANF_TABLE_H_
+
+#include "ringslice.h"
+
+// generated by ringslice_gen from format: +CMGR: "%r[^"]","%15[^"]",,"%r[^"]" %hhu,%4x
+static ringslice_charset_t const cmgr_prog_set0 = {{0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
+static ringslice_charset_t const cmgr_prog_set1 = {{0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
+static ringslice_charset_t const cmgr_prog_set2 = {{0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
+static ringslice_scanf_insn_t const cmgr_prog[] = {
+    RINGSLICE_SCANF_LITERAL("+CMGR:"),
+    RINGSLICE_SCANF_SPACES(),
+    RINGSLICE_SCANF_LITERAL("\""),
+    RINGSLICE_SCANF_SLICE_SCANSET(0, &cmgr_prog_set0),
+    RINGSLICE_SCANF_LITERAL("\",\""),
+    RINGSLICE_SCANF_SCANSET(15, &cmgr_prog_set1),
+    RINGSLICE_SCANF_LITERAL("\",,\""),
+    RINGSLICE_SCANF_SLICE_SCANSET(0, &cmgr_prog_set2),
+    RINGSLICE_SCANF_LITERAL("\""),
+    RINGSLICE_SCANF_SPACES(),
+    RINGSLICE_SCANF_CONV(RINGSLICE_SCANF_OP_UINT, RINGSLICE_SCANF_LEN_HH, 0),
+    RINGSLICE_SCANF_LITERAL(","),
+    RINGSLICE_SCANF_CONV(RINGSLICE_SCANF_OP_HEX, RINGSLICE_SCANF_LEN_NONE, 4),
+    RINGSLICE_SCANF_END(),
+};
+
+#endif // SCANF_TABLE_H_
@@ -0,0 +1,115 @@
+//============================================================================
+// ET: embedded test; tests with RINGSLICE_CONFIG_POW2 enabled
+//============================================================================
+#include <stdio.h>
+#include <string.h>
+
+#include "et.h"  // ET: embedded test
+#include "ringslice.h"
+#include "ringslice_spsc.h"
+
+#if !RINGSLICE_CONFIG_POW2
+#error "build with RINGSLICE_CONFIG_POW2=1 (make POW2=1)"
+#endif
+
+void setup(void) {
+    // executed before *every* non-skipped test
+}
+
+void teardown(void) {
+    // executed after *every* non-skipped and non-failing test
+}
+
+// test group ----------------------------------------------------------------
+TEST_GROUP("Pow2") {
+
+    TEST("Testing ringslice_wrap(), bit masking") {
+        for (ringslice_cnt_t size = 1; size <= 64; size *= 2) {
+            for (ringslice_cnt_t idx = 0; idx < 2 * size; idx++) {
+                VERIFY(ringslice_wrap(idx, size) == idx % size);
+            }
+        }
+    }
+
+    TEST("Testing ringslice_len(), ringslice_nth_byte() and ringslice_subslice(), wrap point at every position") {
+        char const slice_str[] = "+CREG: 2,1,\"1A2B\"\r\n";
+        int const slice_str_len = strlen(slice_str);
+        char buf[32];
+        int const buffer_size = (int)ARRAY_NELEM(buf);
+
+        for (int i = 0; i < buffer_size; i++) {
+            for (int j = 0; j < slice_str_len; j++) {
+                buf[(i + j) % buffer_size] = slice_str[j];
+            }
+            ringslice_t rs = ringslice_initializer((uint8_t *)buf, buffer_size, i, (i + slice_str_len) % buffer_size);
+            VERIFY(ringslice_len(&rs) == slice_str_len);
+            VERIFY(ringslice_strcmp(&rs, slice_str) == 0);
+            for (int j = 0; j < slice_str_len; j++) {
+                VERIFY(ringslice_nth_byte(&rs, j) == (uint8_t)slice_str[j]);
+            }
+
+            ringslice_t sub = ringslice_subslice(&rs, 7, 10);
+            VERIFY(ringslice_strcmp(&sub, "2,1") == 0);
+            VERIFY(sub.first == (i + 7) % buffer_size);
+
+            VERIFY(ringslice_memchr(&rs, '\n') == slice_str_len - 1);
+            ringslice_t found = ringslice_strstr(&rs, "1A2B");
+            VERIFY(ringslice_strcmp(&found, "1A2B") == 0);
+            VERIFY(found.first == (i + 12) % buffer_size);
+
+            int stat = 0, act = 0;
+            unsigned int lac = 0;
+            VERIFY(ringslice_scanf(&rs, "+CREG: %d,%d,\"%x\"", &stat, &act, &lac) == 3);
+            VERIFY(stat == 2 && act == 1 && lac == 0x1A2B);
+        }
+    }
+
+    TEST("Testing ringslice_seq_index() and ringslice_seq_initializer(), counters wrap around 2^32") {
+        char const test_buf[] = "89abcdef01234567";
+        ringslice_cnt_t const buf_size = (ringslice_cnt_t)strlen(test_buf);
+        VERIFY(ringslice_seq_index(UINT32_MAX, buf_size) == buf_size - 1);
+        VERIFY(ringslice_seq_index(UINT32_MAX + (ringslice_seq_t)1, buf_size) == 0);
+
+        ringslice_seq_t const first_seq = UINT32_MAX - 3;  // index 12 of 16 byte buffer
+        ringslice_t rs = ringslice_seq_initializer((uint8_t *)test_buf, buf_size, ringslice_seq_index(first_seq, buf_size),
+                                                   first_seq, first_seq + 10);
+        VERIFY(rs.first == 12);
+        VERIFY(ringslice_len(&rs) == 10);
+        VERIFY(ringslice_strcmp(&rs, "456789abcd") == 0);
+
+        rs = ringslice_seq_initializer((uint8_t *)test_buf, buf_size, 12, first_seq, first_seq + 16);
+        VERIFY(ringslice_len(&rs) == buf_size);
+        VERIFY(ringslice_strcmp(&rs, "456789abcdef0123") == 0);
+    }
+
+    TEST("Testing ringslice_spsc_t, free-running counters wrap around 2^32") {
+        uint8_t buf[8];
+        ringslice_spsc_t ring;
+        ringslice_spsc_init(&ring, buf, (ringslice_cnt_t)ARRAY_NELEM(buf));
+        atomic_store(&ring.head, UINT32_MAX - 4);
+        atomic_store(&ring.tail, UINT32_MAX - 4);
+        ring.head_idx = ringslice_seq_index(UINT32_MAX - 4, ring.buf_size);
+        ring.tail_idx = ring.head_idx;
+
+        for (int i = 0; i < 20; i++) {
+            char const chunk[] = {(char)('a' + i), (char)('A' + i), '0', '1', '2'};
+            VERIFY(ringslice_spsc_push_bulk(&ring, (uint8_t const *)chunk, 5) == 5);
+            VERIFY(ringslice_spsc_push(&ring, '3'));
+            VERIFY(ringslice_spsc_push_bulk(&ring, (uint8_t const *)"45", 2) == 2);
+            VERIFY(!ringslice_spsc_push(&ring, '6'));
+            VERIFY(ringslice_spsc_len(&ring) == 8);
+
+            ringslice_t rs = ringslice_spsc_acquire_readable(&ring);
+            VERIFY(rs.first == ringslice_seq_index(atomic_load(&ring.tail), ring.buf_size));
+            VERIFY(ringslice_len(&rs) == 8);
+            VERIFY(ringslice_strcmp(&rs, (char[]){chunk[0], chunk[1], '0', '1', '2', '3', '4', '5', '\0'}) == 0);
+            ringslice_spsc_release(&ring, 6);
+            rs = ringslice_spsc_acquire_readable(&ring);
+            VERIFY(ringslice_strcmp(&rs, "45") == 0);
+            ringslice_spsc_release(&ring, 2);
+            VERIFY(ringslice_spsc_len(&ring) == 0);
+        }
+        VERIFY(atomic_load(&ring.head) == UINT32_MAX - 4 + 160);
+    }
+
+}  // TEST_GROUP()
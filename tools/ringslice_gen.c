@@ -0,0 +1,65 @@
+//============================================================================
+// Generator of constant ringslice tables on the HOST
+//
+// Usage:
+//   ringslice_gen scanf <name> <format>         - precompiled scanf program
+//   ringslice_gen multi <name> <pattern>...     - multi-pattern search automaton
+//
+// The C source is printed to stdout, e.g. as a build step:
+//   ringslice_gen scanf creg_prog '+CREG: %d,%d' > creg_prog.h
+//============================================================================
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ringslice.h"
+
+/// capacity of generated tables
+#define GEN_CAPACITY 1024
+
+/// size of generated text
+#define GEN_TEXT_SIZE (256 * 1024)
+
+static char gen_text[GEN_TEXT_SIZE];
+
+static int gen_scanf(char const *name, char const *fmt) {
+    static ringslice_scanf_insn_t prog[GEN_CAPACITY];
+    static ringslice_charset_t sets[GEN_CAPACITY];
+    if (ringslice_scanf_compile(prog, GEN_CAPACITY, sets, GEN_CAPACITY, fmt) < 0) {
+        fprintf(stderr, "unsupported format: %s\n", fmt);
+        return EXIT_FAILURE;
+    }
+    if (ringslice_scanf_dump(prog, name, gen_text, GEN_TEXT_SIZE) >= GEN_TEXT_SIZE) {
+        fprintf(stderr, "program is too large\n");
+        return EXIT_FAILURE;
+    }
+    printf("// generated by ringslice_gen from format: %s\n%s", fmt, gen_text);
+    return EXIT_SUCCESS;
+}
+
+static int gen_multi(char const *name, char const *const patterns[], int pattern_cnt) {
+    static ringslice_multi_node_t nodes[GEN_CAPACITY * 8];
+    ringslice_multi_t multi;
+    if (!ringslice_multi_build(&multi, nodes, (ringslice_cnt_t)(sizeof(nodes) / sizeof(nodes[0])), patterns, pattern_cnt)) {
+        fprintf(stderr, "too many patterns\n");
+        return EXIT_FAILURE;
+    }
+    if (ringslice_multi_dump(&multi, name, gen_text, GEN_TEXT_SIZE) >= GEN_TEXT_SIZE) {
+        fprintf(stderr, "automaton is too large\n");
+        return EXIT_FAILURE;
+    }
+    printf("// generated by ringslice_gen from %d patterns\n%s", pattern_cnt, gen_text);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc == 4 && strcmp(argv[1], "scanf") == 0) {
+        return gen_scanf(argv[2], argv[3]);
+    }
+    if (argc >= 4 && strcmp(argv[1], "multi") == 0 && argc - 3 <= INT16_MAX) {
+        return gen_multi(argv[2], (char const *const *)&argv[3], argc - 3);
+    }
+    fprintf(stderr, "usage: %s scanf <name> <format>\n"
+                    "       %s multi <name> <pattern>...\n", argv[0], argv[0]);
+    return EXIT_FAILURE;
+}